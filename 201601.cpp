@@ -15,34 +15,21 @@ using namespace fmt;
 using namespace aoc;
 using namespace std;
 
-tuple<Side, size_t> parseInstruction(const string& instruction)
+tuple<Side, size_t> parseInstruction(std::string_view instruction)
 {
-	static const regex instructionRegex(R"((L|R)(\d+))");
+	char sideTag = 0;
+	size_t numBlocks = 0;
 
-	smatch instructionMatch;
-
-	if(regex_match(instruction,
-	               instructionMatch,
-	               instructionRegex))
+	if(Pattern<"{a}{d}">::match(instruction, sideTag, numBlocks))
 	{
-		constexpr size_t expectedInstructionMatchSize = 3;
-
-		AOC_ENFORCE(instructionMatch.size() == expectedInstructionMatchSize);
-
-		const string& sideTag = instructionMatch[1].str();
-		const size_t numBlocks = stoi(instructionMatch[2].str());
-
-		AOC_ENFORCE(sideTag.size() == 1);
-		AOC_ENFORCE(sideTag[0] == 'L' || sideTag[0] == 'R');
-
-		switch(sideTag[0])
+		switch(sideTag)
 		{
 			case 'L': return make_tuple(Side::Left, numBlocks);
 			case 'R': return make_tuple(Side::Right, numBlocks);
 		}
 	}
-	else
-		panic(format("invalid instruction: '{}'", instruction));
+
+	panic(format("invalid instruction: '{}'", instruction));
 
 	return make_tuple(Side::Left, 0);
 }
@@ -119,7 +106,7 @@ public:
 		}
 	}
 
-	void followInstruction(const string& instruction)
+	void followInstruction(std::string_view instruction)
 	{
 		const auto [side, numBlocks] = parseInstruction(instruction);
 
@@ -129,20 +116,16 @@ public:
 
 	void followInstructions(const string& instructionsStr)
 	{
-		const auto instructions = StringUtils::tokenize(instructionsStr);
-
-		for(const auto& instruction : instructions)
+		for(const auto& instruction : Tokenizer(instructionsStr))
 			followInstruction(instruction);
 	}
 
 	bool followInstructionsUntilTheFirstLocationYouVisitTwiceIsFound(const string& instructionsStr)
 	{
-		positions_.clear();
-		positions_.insert(position());
+		visitedLocations_.clear();
+		visitedLocations_.setCell(x_, y_, true);
 
-		const auto instructions = StringUtils::tokenize(instructionsStr);
-
-		for(const auto& instruction : instructions)
+		for(const auto& instruction : Tokenizer(instructionsStr))
 			if(followInstructionUntilTheFirstLocationYouVisitTwiceIsFound(instruction))
 				return true;
 
@@ -150,7 +133,7 @@ public:
 	}
 
 private:
-	bool followInstructionUntilTheFirstLocationYouVisitTwiceIsFound(const string& instruction)
+	bool followInstructionUntilTheFirstLocationYouVisitTwiceIsFound(std::string_view instruction)
 	{
 		const auto [side, numBlocks] = parseInstruction(instruction);
 
@@ -160,10 +143,8 @@ private:
 		{
 			walk(1);
 
-			if(positions_.contains(position()))
+			if(visitedLocations_.testAndSetCell(x_, y_))
 				return true;
-			else
-				positions_.insert(position());
 		}
 
 		return false;
@@ -173,7 +154,7 @@ private:
 	int x_;
 	int y_;
 	Direction direction_;
-	set<tuple<int, int>> positions_;
+	UnboundedGrid2D<bool> visitedLocations_;
 };
 
 #ifdef AOC_TEST_SOLUTION
@@ -280,6 +261,17 @@ TEST_CASE("Santa")
 		santa.followInstructions("R2, L3");
 		CHECK_SANTA(2, -3, Direction::North);
 	}
+
+	SUBCASE("followInstructionsUntilTheFirstLocationYouVisitTwiceIsFound")
+	{
+		CHECK(santa.followInstructionsUntilTheFirstLocationYouVisitTwiceIsFound("R8, R4, R4, R8"));
+		CHECK_SANTA(4, 0, Direction::North);
+
+		santa.reset();
+
+		CHECK(!santa.followInstructionsUntilTheFirstLocationYouVisitTwiceIsFound("L100, L100, L99"));
+		CHECK_SANTA(-1, 100, Direction::East);
+	}
 }
 
 #else // #ifdef AOC_TEST_SOLUTION
@@ -43,13 +43,13 @@ int SquaresWithThreeSides::answer1()
 
 	for(const auto& line : input())
 	{
-		const auto tokens = StringUtils::tokenize(line, ' ', true, true);
+		std::string_view tokens[3];
 
-		AOC_ENFORCE(tokens.size() == 3);
+		AOC_ENFORCE(StringUtils::tokenize(line, tokens, ' ', true, true) == 3);
 
-		if(isValidTriangle(stoi(tokens[0]),
-		                   stoi(tokens[1]),
-		                   stoi(tokens[2])))
+		if(isValidTriangle(ParseUtils::toInteger<int>(tokens[0]),
+		                   ParseUtils::toInteger<int>(tokens[1]),
+		                   ParseUtils::toInteger<int>(tokens[2])))
 			++numValidTriangles;
 	}
 
@@ -70,23 +70,27 @@ int SquaresWithThreeSides::answer2()
 		const auto& line1 = input()[i * 3 + 1];
 		const auto& line2 = input()[i * 3 + 2];
 
-		const auto tokens0 = StringUtils::tokenize(line0, ' ', true, true);
-		const auto tokens1 = StringUtils::tokenize(line1, ' ', true, true);
-		const auto tokens2 = StringUtils::tokenize(line2, ' ', true, true);
+		std::string_view tokens0[3];
+		std::string_view tokens1[3];
+		std::string_view tokens2[3];
 
-		if(isValidTriangle(stoi(tokens0[0]),
-		                   stoi(tokens1[0]),
-		                   stoi(tokens2[0])))
+		AOC_ENFORCE(StringUtils::tokenize(line0, tokens0, ' ', true, true) == 3);
+		AOC_ENFORCE(StringUtils::tokenize(line1, tokens1, ' ', true, true) == 3);
+		AOC_ENFORCE(StringUtils::tokenize(line2, tokens2, ' ', true, true) == 3);
+
+		if(isValidTriangle(ParseUtils::toInteger<int>(tokens0[0]),
+		                   ParseUtils::toInteger<int>(tokens1[0]),
+		                   ParseUtils::toInteger<int>(tokens2[0])))
 			++numValidTriangles;
 
-		if(isValidTriangle(stoi(tokens0[1]),
-		                   stoi(tokens1[1]),
-		                   stoi(tokens2[1])))
+		if(isValidTriangle(ParseUtils::toInteger<int>(tokens0[1]),
+		                   ParseUtils::toInteger<int>(tokens1[1]),
+		                   ParseUtils::toInteger<int>(tokens2[1])))
 			++numValidTriangles;
 
-		if(isValidTriangle(stoi(tokens0[2]),
-		                   stoi(tokens1[2]),
-		                   stoi(tokens2[2])))
+		if(isValidTriangle(ParseUtils::toInteger<int>(tokens0[2]),
+		                   ParseUtils::toInteger<int>(tokens1[2]),
+		                   ParseUtils::toInteger<int>(tokens2[2])))
 			++numValidTriangles;
 	}
 
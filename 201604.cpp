@@ -8,8 +8,8 @@
 #define FMT_HEADER_ONLY
 #include "fmt/format.h"
 
+#include <algorithm>
 #include <map>
-#include <regex>
 #include <set>
 #include <string>
 
@@ -112,28 +112,33 @@ string RoomListEntry::generateChecksum() const
 	return checksum;
 }
 
-RoomListEntry parseRoomListEntry(const string& line)
+// Pattern letter fields also accept uppercase letters, so the stricter
+// rules of the room list are checked separately.
+bool isValidEncryptedName(std::string_view encryptedName)
 {
-	static const regex roomListEntryRegex(R"(([a-z][a-z\-]+[a-z])-(\d+)\[([a-z]+)\])");
-
-	smatch roomListEntryMatch;
+	return (encryptedName.length() >= 3) &&
+	       (encryptedName.front() != '-') && (encryptedName.back() != '-') &&
+	       std::all_of(encryptedName.begin(), encryptedName.end(),
+	                   [](char character) { return (character >= 'a' && character <= 'z') || character == '-'; });
+}
 
-	if(regex_match(line,
-	               roomListEntryMatch,
-	               roomListEntryRegex))
-	{
-		constexpr size_t expectedRoomListEntryMatchSize = 4;
+bool isValidChecksum(std::string_view checksum)
+{
+	return std::all_of(checksum.begin(), checksum.end(),
+	                   [](char character) { return character >= 'a' && character <= 'z'; });
+}
 
-		AOC_ENFORCE(roomListEntryMatch.size() == expectedRoomListEntryMatchSize);
+RoomListEntry parseRoomListEntry(std::string_view line)
+{
+	std::string_view encryptedName;
+	int sectorID = 0;
+	std::string_view checksum;
 
-		return RoomListEntry(roomListEntryMatch[1],
-		                     stoi(roomListEntryMatch[2]),
-		                     roomListEntryMatch[3]);
-	}
-	else
+	if(!Pattern<"{a-}-{d}[{a}]">::match(line, encryptedName, sectorID, checksum) ||
+	   !isValidEncryptedName(encryptedName) || !isValidChecksum(checksum))
 		panic(format("invalid room list entry: {}", line));
 
-	return RoomListEntry("", 0, "");
+	return RoomListEntry(string(encryptedName), sectorID, string(checksum));
 }
 
 int calculateSumOfSectorIDsOfTheRealRooms(const vector<string>& roomList)
@@ -159,6 +164,9 @@ TEST_CASE("parseRoomListEntry")
 	CHECK(parseRoomListEntry("a-b-c-d-e-f-g-h-987[abcde]") == RoomListEntry("a-b-c-d-e-f-g-h", 987, "abcde"));
 	CHECK(parseRoomListEntry("not-a-real-room-404[oarel]") == RoomListEntry("not-a-real-room", 404, "oarel"));
 	CHECK(parseRoomListEntry("totally-real-room-200[decoy]") == RoomListEntry("totally-real-room", 200, "decoy"));
+	CHECK_THROWS_WITH_AS(parseRoomListEntry("Aaaaa-bbb-123[abxyz]"), "invalid room list entry: Aaaaa-bbb-123[abxyz]", runtime_error);
+	CHECK_THROWS_WITH_AS(parseRoomListEntry("ab-123[abxyz]"), "invalid room list entry: ab-123[abxyz]", runtime_error);
+	CHECK_THROWS_WITH_AS(parseRoomListEntry("aaaaa-bbb-123[abXyz]"), "invalid room list entry: aaaaa-bbb-123[abXyz]", runtime_error);
 }
 
 TEST_CASE("calculateSumOfSectorIDsOfTheRealRooms")
@@ -59,6 +59,38 @@ int numWindowIncreases(const vector<int>& measurements)
 	return numIncreases;
 }
 
+// Single-pass counterpart of numMeasurementIncreases and numWindowIncreases
+// that only keeps the last three measurements around.
+class MeasurementIncreaseCounter
+{
+public:
+	void addMeasurement(int measurement)
+	{
+		if(numMeasurements_ >= 1 && measurement > lastMeasurements_[2])
+			++numMeasurementIncreases_;
+
+		// Consecutive windows share two measurements, so comparing their
+		// sums comes down to comparing the measurements that differ.
+		if(numMeasurements_ >= 3 && measurement > lastMeasurements_[0])
+			++numWindowIncreases_;
+
+		lastMeasurements_[0] = lastMeasurements_[1];
+		lastMeasurements_[1] = lastMeasurements_[2];
+		lastMeasurements_[2] = measurement;
+
+		++numMeasurements_;
+	}
+
+	int numMeasurementIncreases() const { return numMeasurementIncreases_; }
+	int numWindowIncreases() const { return numWindowIncreases_; }
+
+private:
+	int lastMeasurements_[3] = {};
+	size_t numMeasurements_ = 0;
+	int numMeasurementIncreases_ = 0;
+	int numWindowIncreases_ = 0;
+};
+
 #ifdef AOC_TEST_SOLUTION
 
 TEST_CASE("numMeasurementIncreases")
@@ -91,35 +123,51 @@ TEST_CASE("numWindowIncreases")
 	CHECK(numWindowIncreases({199, 200, 208, 210, 200, 207, 240, 269, 260, 263}) == 5);
 }
 
+TEST_CASE("MeasurementIncreaseCounter")
+{
+	const vector<int> measurements{199, 200, 208, 210, 200, 207, 240, 269, 260, 263};
+
+	MeasurementIncreaseCounter measurementIncreaseCounter;
+
+	for(int measurement : measurements)
+		measurementIncreaseCounter.addMeasurement(measurement);
+
+	CHECK(measurementIncreaseCounter.numMeasurementIncreases() == numMeasurementIncreases(measurements));
+	CHECK(measurementIncreaseCounter.numWindowIncreases() == numWindowIncreases(measurements));
+}
+
 #else // #ifdef AOC_TEST_SOLUTION
 
 class SonarSweep : public PuzzleSolution<int>
 {
+public:
+	SonarSweep()
+		: PuzzleSolution(InputMode::StreamingWithReadAhead)
+	{
+	}
+
 private:
-	void processInput(const string& puzzleInputFilePath) override;
+	void processLine(std::string_view line) override;
 	int answer1() override;
 	int answer2() override;
 
 private:
-	vector<int> depthMeasurements_;
+	MeasurementIncreaseCounter measurementIncreaseCounter_;
 };
 
-void SonarSweep::processInput(const string& puzzleInputFilePath)
+void SonarSweep::processLine(std::string_view line)
 {
-	PuzzleSolution::processInput(puzzleInputFilePath);
-
-	for(const auto& line : input())
-		depthMeasurements_.push_back(stoi(line));
+	measurementIncreaseCounter_.addMeasurement(ParseUtils::toInteger<int>(line));
 }
 
 int SonarSweep::answer1()
 {
-	return numMeasurementIncreases(depthMeasurements_);
+	return measurementIncreaseCounter_.numMeasurementIncreases();
 }
 
 int SonarSweep::answer2()
 {
-	return numWindowIncreases(depthMeasurements_);
+	return measurementIncreaseCounter_.numWindowIncreases();
 }
 
 int main(int argc, char* argv[])
@@ -37,7 +37,7 @@ DigitNameToDigit digitNameToDigitLUT[] =
 	{ "nine", '9' },
 };
 
-tuple<size_t, char> findFirstDigitByChar(const string& line)
+tuple<size_t, char> findFirstDigitByChar(std::string_view line)
 {
 	const size_t pos = line.find_first_of(digits);
 
@@ -45,7 +45,7 @@ tuple<size_t, char> findFirstDigitByChar(const string& line)
 	                             : make_tuple(string::npos, '\0');
 }
 
-tuple<size_t, char> findLastDigitByChar(const string& line)
+tuple<size_t, char> findLastDigitByChar(std::string_view line)
 {
 	const size_t pos = line.find_last_of(digits);
 
@@ -53,7 +53,7 @@ tuple<size_t, char> findLastDigitByChar(const string& line)
 	                             : make_tuple(string::npos, '\0');
 }
 
-tuple<size_t, char> findFirstDigitByName(const string& line)
+tuple<size_t, char> findFirstDigitByName(std::string_view line)
 {
 	size_t firstDigitNamePos = line.size();
 	size_t firstDigitNameIndex = 0;
@@ -82,7 +82,7 @@ tuple<size_t, char> findFirstDigitByName(const string& line)
 		return make_tuple(string::npos, '\0');
 }
 
-tuple<size_t, char> findLastDigitByName(const string& line)
+tuple<size_t, char> findLastDigitByName(std::string_view line)
 {
 	size_t lastDigitNamePos = 0;
 	size_t lastDigitNameIndex = 0;
@@ -111,7 +111,7 @@ tuple<size_t, char> findLastDigitByName(const string& line)
 		return make_tuple(string::npos, '\0');
 }
 
-char findFirstDigit(const string& line)
+char findFirstDigit(std::string_view line)
 {
 	const auto [firstDigitFoundByCharPos, firstDigitFoundByChar] =
 		findFirstDigitByChar(line);
@@ -135,7 +135,7 @@ char findFirstDigit(const string& line)
 	return '\0';
 }
 
-char findLastDigit(const string& line)
+char findLastDigit(std::string_view line)
 {
 	const auto [lastDigitFoundByCharPos, lastDigitFoundByChar] =
 		findLastDigitByChar(line);
@@ -172,7 +172,7 @@ int digitsToInt(char digit1, char digit2)
 	return 10 * digitToInt(digit1) + digitToInt(digit2);
 }
 
-int extractCalibrationValue1(const string& line)
+int extractCalibrationValue1(std::string_view line)
 {
 	const auto [firstDigitPos, firstDigit] = findFirstDigitByChar(line);
 
@@ -186,7 +186,7 @@ int extractCalibrationValue1(const string& line)
 	return digitsToInt(firstDigit, lastDigit);
 }
 
-int extractCalibrationValue2(const string& line)
+int extractCalibrationValue2(std::string_view line)
 {
 	return digitsToInt(findFirstDigit(line), findLastDigit(line));
 }
@@ -337,29 +337,36 @@ TEST_CASE("extractCalibrationValue2")
 
 class Trebuchet : public PuzzleSolution<int>
 {
+public:
+	Trebuchet()
+		: PuzzleSolution(InputMode::StreamingWithReadAhead)
+	{
+	}
+
 private:
+	void processLine(std::string_view line) override;
 	int answer1() override;
 	int answer2() override;
+
+private:
+	int sum1_ = 0;
+	int sum2_ = 0;
 };
 
-int Trebuchet::answer1()
+void Trebuchet::processLine(std::string_view line)
 {
-	int sum = 0;
-
-	for(const auto& line : input())
-		sum += extractCalibrationValue1(line);
+	sum1_ += extractCalibrationValue1(line);
+	sum2_ += extractCalibrationValue2(line);
+}
 
-	return sum;
+int Trebuchet::answer1()
+{
+	return sum1_;
 }
 
 int Trebuchet::answer2()
 {
-	int sum = 0;
-
-	for(const auto& line : input())
-		sum += extractCalibrationValue2(line);
-
-	return sum;
+	return sum2_;
 }
 
 int main(int argc, char* argv[])
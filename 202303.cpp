@@ -46,12 +46,7 @@ Number parseNumber(const string& line, size_t& pos)
 
 	Number number(startPos);
 
-	++pos;
-	while(pos < line.size())
-		if(isdigit(line[pos]))
-			++pos;
-		else
-			break;
+	AOC_ENFORCE(ParseUtils::parseInteger(line, pos, number.value_));
 
 	const size_t endPos = pos - 1;
 
@@ -63,9 +58,7 @@ Number parseNumber(const string& line, size_t& pos)
 
 	AOC_ASSERT(pos > startPos);
 	AOC_ASSERT((pos >= 1) && (pos <= line.size()));
-	AOC_ASSERT(!isdigit(line[pos]));
-
-	number.value_ = stoi(string(line, startPos, pos - startPos));
+	AOC_ASSERT((pos == line.size()) || !isdigit(line[pos]));
 
 	return number;
 }
@@ -64,30 +64,26 @@ BoatRaceLog parseBoatRaceLog1(const vector<string>& input)
 	constexpr auto trimWhitespace = true;
 	constexpr auto skipEmptyTokens = true;
 
-	const auto timeValueTokens = StringUtils::tokenize(timeLogTokens[1],
-	                                                   ' ',
-	                                                   trimWhitespace,
-	                                                   skipEmptyTokens);
-
 	vector<long long> timeValues;
 
-	for(auto const& timeValueToken : timeValueTokens)
-		timeValues.push_back(stoi(timeValueToken));
+	for(auto const& timeValueToken : Tokenizer(timeLogTokens[1],
+	                                           ' ',
+	                                           trimWhitespace,
+	                                           skipEmptyTokens))
+		timeValues.push_back(ParseUtils::toInteger<long long>(timeValueToken));
 
 	const auto distanceLogTokens = StringUtils::tokenize(input[1], ':');
 
 	AOC_ENFORCE(distanceLogTokens.size() == 2);
 	AOC_ENFORCE(distanceLogTokens[0] == "Distance");
 
-	const auto distanceValueTokens = StringUtils::tokenize(distanceLogTokens[1],
-	                                                       ' ',
-	                                                       trimWhitespace,
-	                                                       skipEmptyTokens);
-
 	vector<long long> distanceValues;
 
-	for(auto const& distanceValueToken : distanceValueTokens)
-		distanceValues.push_back(stoll(distanceValueToken));
+	for(auto const& distanceValueToken : Tokenizer(distanceLogTokens[1],
+	                                               ' ',
+	                                               trimWhitespace,
+	                                               skipEmptyTokens))
+		distanceValues.push_back(ParseUtils::toInteger<long long>(distanceValueToken));
 
 	AOC_ENFORCE(timeValues.size() == distanceValues.size());
 
@@ -112,14 +108,12 @@ BoatRaceLog parseBoatRaceLog2(const vector<string>& input)
 	constexpr auto trimWhitespace = true;
 	constexpr auto skipEmptyTokens = true;
 
-	const auto timeValueTokens = StringUtils::tokenize(timeLogTokens[1],
-	                                                   ' ',
-	                                                   trimWhitespace,
-	                                                   skipEmptyTokens);
-
 	string timeStr;
 
-	for(auto const& timeValueToken : timeValueTokens)
+	for(auto const& timeValueToken : Tokenizer(timeLogTokens[1],
+	                                           ' ',
+	                                           trimWhitespace,
+	                                           skipEmptyTokens))
 		timeStr += timeValueToken;
 
 	const auto distanceLogTokens = StringUtils::tokenize(input[1], ':');
@@ -127,20 +121,18 @@ BoatRaceLog parseBoatRaceLog2(const vector<string>& input)
 	AOC_ENFORCE(distanceLogTokens.size() == 2);
 	AOC_ENFORCE(distanceLogTokens[0] == "Distance");
 
-	const auto distanceValueTokens = StringUtils::tokenize(distanceLogTokens[1],
-	                                                       ' ',
-	                                                       trimWhitespace,
-	                                                       skipEmptyTokens);
-
 	string distanceStr;
 
-	for(auto const& distanceValueToken : distanceValueTokens)
+	for(auto const& distanceValueToken : Tokenizer(distanceLogTokens[1],
+	                                               ' ',
+	                                               trimWhitespace,
+	                                               skipEmptyTokens))
 		distanceStr += distanceValueToken;
 
 	BoatRaceLog log;
 
-	log.entries_.push_back(BoatRaceLogEntry(stoll(timeStr),
-	                                        stoll(distanceStr)));
+	log.entries_.push_back(BoatRaceLogEntry(ParseUtils::toInteger<long long>(timeStr),
+	                                        ParseUtils::toInteger<long long>(distanceStr)));
 
 	return log;
 }
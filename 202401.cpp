@@ -16,11 +16,18 @@ using namespace std;
 
 tuple<int, int> parseLocationIDs(const string& line)
 {
-	auto tokens = StringUtils::tokenize(line, ' ', false, true);
+	size_t pos = 0;
+	int locationID1 = 0;
+	int locationID2 = 0;
 
-	AOC_ENFORCE(tokens.size() == 2);
+	AOC_ENFORCE(ParseUtils::parseInteger(line, pos, locationID1));
 
-	return make_tuple(stoi(tokens[0]), stoi(tokens[1]));
+	ParseUtils::skipWhitespace(line, pos);
+
+	AOC_ENFORCE(ParseUtils::parseInteger(line, pos, locationID2));
+	AOC_ENFORCE(pos == line.size());
+
+	return make_tuple(locationID1, locationID2);
 }
 
 void parseLocationIDLists(const vector<string>& input,
@@ -98,16 +98,27 @@ bool Report::isSafe() const
 	return isReportSafe(*this);
 }
 
-Report parseReport(const string& line)
+Report parseReport(std::string_view line)
 {
-	auto tokens = StringUtils::tokenize(line, ' ');
-
-	AOC_ENFORCE(tokens.size() >= 2);
+	size_t pos = 0;
 
 	Report report;
 
-	for(const auto& token : tokens)
-		report.addLevel(stoi(token));
+	while(true)
+	{
+		ParseUtils::skipWhitespace(line, pos);
+
+		if(pos == line.size())
+			break;
+
+		int level = 0;
+
+		AOC_ENFORCE(ParseUtils::parseInteger(line, pos, level));
+
+		report.addLevel(level);
+	}
+
+	AOC_ENFORCE(report.numLevels() >= 2);
 
 	return report;
 }
@@ -219,12 +230,13 @@ size_t UnusualData::numSafeReportsWithProblemDampenerApplied() const
 	return numSafeReports;
 }
 
-UnusualData parseUnusualData(const vector<string>& input)
+template<class Lines>
+UnusualData parseUnusualData(const Lines& input)
 {
 	UnusualData unusualData;
 
-	for(const auto& line : input)
-		unusualData.addReport(parseReport(line));
+	for(auto& report : ParallelLineParser<Report>().parseLines(input, parseReport))
+		unusualData.addReport(report);
 
 	return unusualData;
 }
@@ -390,7 +402,7 @@ void RedNosedReports::processInput(const string& puzzleInputFilePath)
 {
 	PuzzleSolution::processInput(puzzleInputFilePath);
 
-	unusualData_ = parseUnusualData(input());
+	unusualData_ = parseUnusualData(puzzleInput());
 }
 
 int RedNosedReports::answer1()
@@ -15,59 +15,19 @@ using namespace std;
 size_t countWord(const BoundedGrid2D<char>& wordSearch,
                  const string& word)
 {
-	size_t wordCounter = 0;
-
-	for(size_t y=0; y<wordSearch.height(); ++y)
-	{
-		wordCounter += StringUtils::countNonOverlappingSubstrings(wordSearch.constRow(y).toString(), word);
-		wordCounter += StringUtils::countNonOverlappingSubstrings(wordSearch.constReverseRow(y).toString(), word);
-	}
-
-	for(size_t x=0; x<wordSearch.width(); ++x)
-	{
-		wordCounter += StringUtils::countNonOverlappingSubstrings(wordSearch.constColumn(x).toString(), word);
-		wordCounter += StringUtils::countNonOverlappingSubstrings(wordSearch.constReverseColumn(x).toString(), word);
-	}
-
-	for(size_t i=0; i<wordSearch.numDiagonals(); ++i)
-	{
-		wordCounter += StringUtils::countNonOverlappingSubstrings(wordSearch.constTopDownDiagonal(i).toString(), word);
-		wordCounter += StringUtils::countNonOverlappingSubstrings(wordSearch.constReverseTopDownDiagonal(i).toString(), word);
-		wordCounter += StringUtils::countNonOverlappingSubstrings(wordSearch.constBottomUpDiagonal(i).toString(), word);
-		wordCounter += StringUtils::countNonOverlappingSubstrings(wordSearch.constReverseBottomUpDiagonal(i).toString(), word);
-	}
-
-	return wordCounter;
+	return GridWordSearch::countWord(wordSearch, word);
 }
 
 size_t countXMasPattern(const BoundedGrid2D<char>& wordSearch)
 {
-	AOC_ENFORCE(wordSearch.width() >= 3 &&
-	            wordSearch.height() >= 3);
-
-	BoundedGrid2D<char> subGrid(3, 3);
-
-	size_t xMasPatternCounter = 0;
-	
-	for(size_t x=0; x<wordSearch.width()-2; ++x)
-	{
-		for(size_t y=0; y<wordSearch.height()-2; ++y)
-		{
-			for(size_t x1=0; x1<3; ++x1)
-				for(size_t y1=0; y1<3; ++y1)
-					subGrid.setCell(x1, y1, wordSearch.cell(x+x1, y+y1));
-
-			if((subGrid.constTopDownDiagonal(2).toString() == "MAS" ||
-			    subGrid.constReverseTopDownDiagonal(2).toString() == "MAS") &&
-			   (subGrid.constBottomUpDiagonal(2).toString() == "MAS" ||
-			    subGrid.constReverseBottomUpDiagonal(2).toString() == "MAS"))
-			{
-				++xMasPatternCounter;
-			}
-		}
-	}
-
-	return xMasPatternCounter;
+	// The four rotations cover every way of reading both "MAS" diagonals.
+	static const GridPattern xMasPattern({ "M.S",
+	                                       ".A.",
+	                                       "M.S" },
+	                                     '.',
+	                                     GridPattern::rotations);
+
+	return xMasPattern.count(wordSearch);
 }
 
 #ifdef AOC_TEST_SOLUTION
@@ -144,10 +104,10 @@ void CeresSearch::processInput(const string& puzzleInputFilePath)
 {
 	PuzzleSolution::processInput(puzzleInputFilePath);
 
-	AOC_ENFORCE(!input().empty());
-	AOC_ENFORCE(!(input()[0].empty()));
+	AOC_ENFORCE(!puzzleInput().empty());
+	AOC_ENFORCE(!(puzzleInput()[0].empty()));
 
-	wordSearch_.reset(input());
+	wordSearch_.reset(puzzleInput());
 }
 
 int CeresSearch::answer1()
@@ -14,23 +14,34 @@ using namespace std;
 
 tuple<int, int> parsePageOrderingRule(const string& line)
 {
-	auto tokens = StringUtils::tokenize(line, '|', false, true);
+	size_t pos = 0;
+	int precedingPageNumber = 0;
+	int followingPageNumber = 0;
 
-	AOC_ENFORCE(tokens.size() == 2);
+	AOC_ENFORCE(ParseUtils::parseInteger(line, pos, precedingPageNumber));
+	AOC_ENFORCE(ParseUtils::skipChar(line, pos, '|'));
+	AOC_ENFORCE(ParseUtils::parseInteger(line, pos, followingPageNumber));
+	AOC_ENFORCE(pos == line.size());
 
-	return make_tuple(stoi(tokens[0]), stoi(tokens[1]));
+	return make_tuple(precedingPageNumber, followingPageNumber);
 }
 
 vector<int> parsePageNumbers(const string& line)
 {
-	auto tokens = StringUtils::tokenize(line, ',', false, false);
+	vector<int> pageNumbers;
+	size_t pos = 0;
+
+	do
+	{
+		int pageNumber = 0;
 
-	AOC_ENFORCE(tokens.size() > 0);
+		AOC_ENFORCE(ParseUtils::parseInteger(line, pos, pageNumber));
 
-	vector<int> pageNumbers;
+		pageNumbers.push_back(pageNumber);
+	}
+	while(ParseUtils::skipChar(line, pos, ','));
 
-	for(const auto& token : tokens)
-		pageNumbers.push_back(stoi(token));
+	AOC_ENFORCE(pos == line.size());
 
 	return pageNumbers;
 }
@@ -195,6 +206,10 @@ TEST_CASE("parsePageOrderingRule")
 TEST_CASE("parsePageNumbers")
 {
 	CHECK(parsePageNumbers("75,47,61,53,29") == vector<int>{ 75, 47, 61, 53, 29 });
+	CHECK(parsePageNumbers("75") == vector<int>{ 75 });
+	CHECK_THROWS_AS(parsePageNumbers("75,x,47"), runtime_error);
+	CHECK_THROWS_AS(parsePageNumbers("75,47,"), runtime_error);
+	CHECK_THROWS_AS(parsePageNumbers(""), runtime_error);
 }
 
 TEST_CASE("PageOrderingRuleSet")
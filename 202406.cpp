@@ -48,33 +48,32 @@ public:
 
 public:
 	Lab(const std::vector<std::string>& lines)
-		: map_(lines)
+		: initialMap_(lines)
+		, map_(initialMap_)
 	{
 	}
 
+	Lab(const Lab&) = delete;
+	Lab& operator=(const Lab&) = delete;
+
 public:
-	BoundedGrid2D<char>& map() { return map_; }
-	const BoundedGrid2D<char>& map() const { return map_; }
+	OverlayGrid2D<char>& map() { return map_; }
+	const OverlayGrid2D<char>& map() const { return map_; }
+
+	// Undoes all changes made to the map since the lab was set up.
+	void reset() { map_.reset(); }
 
 public:
 	Point2uz findGuardStartPosition() const;
 
 private:
-	BoundedGrid2D<char> map_;
+	BoundedGrid2D<char> initialMap_;
+	OverlayGrid2D<char> map_;
 };
 
 Point2uz Lab::findGuardStartPosition() const
 {
-	Point2uz guardStartPosition;
-
-	for(char directionChar : directionChars)
-	{
-		guardStartPosition = map_.findCell(directionChar);
-
-		if(guardStartPosition.x_ != BoundedGrid2D<char>::npos &&
-		   guardStartPosition.y_ != BoundedGrid2D<char>::npos)
-			break;
-	}
+	const Point2uz guardStartPosition = map_.findAnyCell(span<const char>(directionChars));
 
 	AOC_ENFORCE(guardStartPosition.x_ != BoundedGrid2D<char>::npos &&
 	            guardStartPosition.y_ != BoundedGrid2D<char>::npos);
@@ -104,7 +103,9 @@ public:
 	}
 
 public:
-	bool predictPath(vector<Point2i>* guardPath=nullptr);
+	// The path is marked on the lab's map unless markPath is false, which
+	// leaves the map untouched when only the outcome matters.
+	bool predictPath(vector<Point2i>* guardPath=nullptr, bool markPath=true);
 
 #ifdef AOC_TEST_SOLUTION
 public:
@@ -117,16 +118,21 @@ private:
 	Direction direction_;
 };
 
-bool Guard::predictPath(vector<Point2i>* guardPath)
+bool Guard::predictPath(vector<Point2i>* guardPath, bool markPath)
 {
 	AOC_ASSERT(!isOutOfLab(currentPosition_));
 
 	if(guardPath)
 		guardPath->clear();
 
-	lab_.map().setCell(currentPosition_, Lab::guardPathChar);
+	// Only consulted when recording the path, to keep it free of duplicates.
+	BitGrid isOnGuardPath(guardPath ? lab_.map().width() : 0,
+	                      guardPath ? lab_.map().height() : 0);
+
+	if(markPath)
+		lab_.map().setCell(currentPosition_, Lab::guardPathChar);
 	if(guardPath)
-		if(find(guardPath->begin(), guardPath->end(), currentPosition_) == guardPath->end())
+		if(!isOnGuardPath.testAndSetCell(currentPosition_))
 			guardPath->push_back(currentPosition_);
 
 	const size_t maxSteps = lab_.map().numCells();
@@ -148,9 +154,10 @@ bool Guard::predictPath(vector<Point2i>* guardPath)
 		{
 			currentPosition_ = nextPosition;
 
-			lab_.map().setCell(currentPosition_, Lab::guardPathChar);
+			if(markPath)
+				lab_.map().setCell(currentPosition_, Lab::guardPathChar);
 			if(guardPath)
-				if(find(guardPath->begin(), guardPath->end(), currentPosition_) == guardPath->end())
+				if(!isOnGuardPath.testAndSetCell(currentPosition_))
 					guardPath->push_back(currentPosition_);
 
 			++stepCounter;
@@ -294,6 +301,30 @@ TEST_CASE("Guard")
 
 		CHECK(!succeed);
 	}
+
+	SUBCASE("reset")
+	{
+		const string initialMap = lab.map().toString();
+
+		lab.map().setCell(3, 6, Lab::obstacleChar);
+
+		CHECK(!guard.predictPath());
+
+		lab.reset();
+
+		CHECK(lab.map().toString() == initialMap);
+		CHECK(lab.map().numModifiedCells() == 0);
+
+		lab.map().setCell(3, 6, Lab::obstacleChar);
+
+		CHECK(!Guard(lab).predictPath(nullptr, false));
+		CHECK(lab.map().numModifiedCells() == 1);
+
+		lab.reset();
+
+		CHECK(Guard(lab).predictPath());
+		CHECK(lab.map().count(Lab::guardPathChar) == 41);
+	}
 }
 
 #else // #ifdef AOC_TEST_SOLUTION
@@ -334,15 +365,15 @@ int GuardGallivant::answer2()
 
 	for(const auto& position : guardPath_)
 	{
-		Lab lab(input());
+		lab_->reset();
 
-		if(!isDirectionChar(lab.map().cell(position)))
+		if(!isDirectionChar(lab_->map().cell(position)))
 		{
-			lab.map().setCell(position, Lab::obstacleChar);
+			lab_->map().setCell(position, Lab::obstacleChar);
 
-			Guard guard(lab);
+			Guard guard(*lab_);
 
-			if(!guard.predictPath())
+			if(!guard.predictPath(nullptr, false))
 			{
 				++loopCausingObstaclePositionCounter;
 			}
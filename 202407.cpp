@@ -16,7 +16,7 @@ using namespace std;
 
 class CalibrationEquation
 {
-	friend CalibrationEquation parseCalibrationEquation(const string& line);
+	friend CalibrationEquation parseCalibrationEquation(std::string_view line);
 
 	friend bool operator==(const CalibrationEquation&,
 	                       const CalibrationEquation&) = default;
@@ -57,36 +57,57 @@ private:
 	vector<int64_t> numbers_;
 };
 
-CalibrationEquation parseCalibrationEquation(const string& line)
+CalibrationEquation parseCalibrationEquation(std::string_view line)
 {
-	const auto tokens = StringUtils::tokenize(line, ' ', false);
+	size_t pos = 0;
+	int64_t testValue = 0;
 
-	AOC_ENFORCE(tokens.size() >= 3);
-	AOC_ENFORCE(tokens[0].size() >= 2);
-	AOC_ENFORCE(tokens[0].back() == ':');
+	AOC_ENFORCE(ParseUtils::parseInteger(line, pos, testValue));
+	AOC_ENFORCE(ParseUtils::skipChar(line, pos, ':'));
 
-	const string testValueStr = tokens[0].substr(0, tokens[0].size()-1);
+	CalibrationEquation calibrationEquation(testValue);
 
-	AOC_ASSERT(testValueStr.size() >= 1);
-	AOC_ASSERT(testValueStr.back() != ':');
+	while(pos < line.size())
+	{
+		AOC_ENFORCE(ParseUtils::skipChar(line, pos, ' '));
+
+		int64_t number = 0;
+
+		AOC_ENFORCE(ParseUtils::parseInteger(line, pos, number));
 
-	CalibrationEquation calibrationEquation(strtoll(testValueStr.c_str(), nullptr, 10));
+		calibrationEquation.numbers_.push_back(number);
+	}
 
-	for(size_t i=1; i<tokens.size(); ++i)
-		calibrationEquation.numbers_.push_back(strtoll(tokens[i].c_str(), nullptr, 10));
+	AOC_ENFORCE(calibrationEquation.numbers_.size() >= 2);
 
 	return calibrationEquation;
 }
 
-void parseCalibrationEquations(const vector<string>& lines,
+template<class Lines>
+void parseCalibrationEquations(const Lines& lines,
                                vector<CalibrationEquation>& calibrationEquations)
 {
-	for(const auto& line : lines)
-		calibrationEquations.push_back(parseCalibrationEquation(line));
+	auto parsedCalibrationEquations = ParallelLineParser<CalibrationEquation>().parseLines(lines, parseCalibrationEquation);
+
+	calibrationEquations.insert(calibrationEquations.end(),
+	                            make_move_iterator(parsedCalibrationEquations.begin()),
+	                            make_move_iterator(parsedCalibrationEquations.end()));
+}
+
+int64_t concatenate(int64_t left, int64_t right)
+{
+	AOC_ASSERT(right >= 0);
+
+	int64_t multiplier = 10;
+
+	while(multiplier <= right)
+		multiplier *= 10;
+
+	return left * multiplier + right;
 }
 
 int64_t evaluate(const vector<int64_t>& numbers,
-                 const string& operators)
+                 std::string_view operators)
 {
 	AOC_ASSERT(numbers.size() >= 2);
 	AOC_ASSERT(operators.size() == numbers.size() - 1);
@@ -101,7 +122,7 @@ int64_t evaluate(const vector<int64_t>& numbers,
 		{
 			case '+': result += numbers[i+1]; break;
 			case '*': result *= numbers[i+1]; break;
-			case '|': result = strtoll((to_string(result) + to_string(numbers[i+1])).c_str(), nullptr, 10); break;
+			case '|': result = concatenate(result, numbers[i+1]); break;
 
 			default: panic(format("invalid operator: '{}'", operators[i]));
 		}
@@ -119,11 +140,7 @@ size_t numValidOperatorConfigurations(const CalibrationEquation& calibrationEqua
 
 	AOC_ASSERT(calibrationEquation.numOperators() >= 1);
 
-	vector<string> operatorsVariations;
-
-	StringUtils::generateVariations(operators,
-	                                calibrationEquation.numOperators(),
-	                                operatorsVariations);
+	const Variations operatorsVariations(operators, calibrationEquation.numOperators());
 
 	for(const auto& operatorsVariation : operatorsVariations)
 	{
@@ -293,7 +310,7 @@ void BridgeRepair::processInput(const string& puzzleInputFilePath)
 {
 	PuzzleSolution::processInput(puzzleInputFilePath);
 
-	parseCalibrationEquations(input(), calibrationEquations_);
+	parseCalibrationEquations(puzzleInput(), calibrationEquations_);
 }
 
 int64_t BridgeRepair::answer1()
@@ -8,9 +8,6 @@
 #define FMT_HEADER_ONLY
 #include "fmt/format.h"
 
-#include <set>
-#include <tuple>
-
 using namespace fmt;
 using namespace aoc;
 using namespace std;
@@ -20,87 +17,85 @@ inline bool isDigit(char height)
 	return height >= '0' && height <= '9';
 }
 
-void followTrailhead1(const BoundedGrid2D<char>& topographicMap,
-                      size_t x, size_t y, char height,
-                      set<tuple<size_t, size_t>>& topPositions)
+// Trails only ever climb by exactly one height.
+auto trailStep(const BoundedGrid2D<char>& topographicMap)
 {
-	AOC_ASSERT(isDigit(height));
-
-	if(height == '9')
+	return [&](const Point2uz& from, const Point2uz& to)
 	{
-		topPositions.insert(make_tuple(x, y));
-
-		return;
-	}
-
-	if((y > 0) && (topographicMap.cell(x, y-1) == height+1))
-		followTrailhead1(topographicMap, x, y-1, height+1, topPositions);
-
-	if((y < topographicMap.height()-1) && (topographicMap.cell(x, y+1) == height+1))
-		followTrailhead1(topographicMap, x, y+1, height+1, topPositions);
-
-	if((x > 0) && (topographicMap.cell(x-1, y) == height+1))
-		followTrailhead1(topographicMap, x-1, y, height+1, topPositions);
-
-	if((x < topographicMap.width()-1) && (topographicMap.cell(x+1, y) == height+1))
-		followTrailhead1(topographicMap, x+1, y, height+1, topPositions);
+		return topographicMap.cell(to) == topographicMap.cell(from)+1;
+	};
 }
 
-void followTrailhead2(const BoundedGrid2D<char>& topographicMap,
-                      size_t x, size_t y, char height, int& rating)
+vector<Point2uz> trailheads(const BoundedGrid2D<char>& topographicMap)
 {
-	AOC_ASSERT(isDigit(height));
+	vector<Point2uz> trailheads;
 
-	if(height == '9')
-	{
-		rating += 1;
-
-		return;
-	}
-
-	if((y > 0) && (topographicMap.cell(x, y-1) == height+1))
-		followTrailhead2(topographicMap, x, y-1, height+1, rating);
-
-	if((y < topographicMap.height()-1) && (topographicMap.cell(x, y+1) == height+1))
-		followTrailhead2(topographicMap, x, y+1, height+1, rating);
-
-	if((x > 0) && (topographicMap.cell(x-1, y) == height+1))
-		followTrailhead2(topographicMap, x-1, y, height+1, rating);
+	for(size_t y=0; y<topographicMap.height(); ++y)
+		for(size_t x=0; x<topographicMap.width(); ++x)
+			if(topographicMap.cell(x, y) == '0')
+				trailheads.emplace_back(x, y);
 
-	if((x < topographicMap.width()-1) && (topographicMap.cell(x+1, y) == height+1))
-		followTrailhead2(topographicMap, x+1, y, height+1, rating);
+	return trailheads;
 }
 
 int topographicMapScore(const BoundedGrid2D<char>& topographicMap)
 {
+	// Every position is explored at most once per trailhead, so each
+	// reachable top is counted once however many trails lead to it.
+	GridTraversal traversal(topographicMap.width(), topographicMap.height());
+
 	int score = 0;
 
-	for(size_t x=0; x<topographicMap.width(); ++x)
+	auto countTop = [&](const Point2uz& pos)
 	{
-		for(size_t y=0; y<topographicMap.height(); ++y)
-		{
-			if(topographicMap.cell(x, y) == '0')
-			{
-				set<tuple<size_t, size_t>> topPositions;
+		AOC_ASSERT(isDigit(topographicMap.cell(pos)));
 
-				followTrailhead1(topographicMap, x, y, '0', topPositions);
+		if(topographicMap.cell(pos) == '9')
+			++score;
+	};
 
-				score += topPositions.size();
-			}
-		}
-	}
+	for(const Point2uz& trailhead : trailheads(topographicMap))
+		traversal.breadthFirst(trailhead, trailStep(topographicMap), countTop);
 
 	return score;
 }
 
 int topographicMapRating(const BoundedGrid2D<char>& topographicMap)
 {
+	GridTraversal traversal(topographicMap.width(), topographicMap.height());
+
+	// The number of trails from any trailhead to each position. A position
+	// of height h is h steps away from every trailhead it can be reached
+	// from, so a breadth-first traversal from all trailheads at once visits
+	// it only after all the positions its trails come from.
+	BoundedGrid2D<int> numTrails(topographicMap.width(), topographicMap.height(), 0);
+
+	const vector<Point2uz> starts = trailheads(topographicMap);
+
+	for(const Point2uz& trailhead : starts)
+		numTrails.cell(trailhead) = 1;
+
+	auto canStep = [&, isTrailStep = trailStep(topographicMap)](const Point2uz& from, const Point2uz& to)
+	{
+		if(!isTrailStep(from, to))
+			return false;
+
+		numTrails.cell(to) += numTrails.cell(from);
+
+		return true;
+	};
+
 	int rating = 0;
 
-	for(size_t x=0; x<topographicMap.width(); ++x)
-		for(size_t y=0; y<topographicMap.height(); ++y)
-			if(topographicMap.cell(x, y) == '0')
-				followTrailhead2(topographicMap, x, y, '0', rating);
+	auto countTrails = [&](const Point2uz& pos)
+	{
+		AOC_ASSERT(isDigit(topographicMap.cell(pos)));
+
+		if(topographicMap.cell(pos) == '9')
+			rating += numTrails.cell(pos);
+	};
+
+	traversal.breadthFirst(starts, canStep, countTrails);
 
 	return rating;
 }
@@ -263,10 +258,10 @@ void HoofIt::processInput(const string& puzzleInputFilePath)
 {
 	PuzzleSolution::processInput(puzzleInputFilePath);
 
-	AOC_ENFORCE(!input().empty());
-	AOC_ENFORCE(!(input()[0].empty()));
+	AOC_ENFORCE(!puzzleInput().empty());
+	AOC_ENFORCE(!(puzzleInput()[0].empty()));
 
-	topographicMap_.reset(input());
+	topographicMap_.reset(puzzleInput());
 }
 
 int HoofIt::answer1()
@@ -40,30 +40,26 @@ tuple<uint64_t, uint64_t> splitNumber(uint64_t number)
 	const string leftSubstr = numberStr.substr(0, substrSize);
 	const string rightSubstr = StringUtils::ltrim(numberStr.substr(substrSize, substrSize), '0');
 
-	return make_tuple(stoll(leftSubstr),
-	                  (!rightSubstr.empty()) ? stoll(rightSubstr) : 0);
+	return make_tuple(ParseUtils::toInteger<uint64_t>(leftSubstr),
+	                  (!rightSubstr.empty()) ? ParseUtils::toInteger<uint64_t>(rightSubstr) : 0);
 }
 
 void parseStoneNumbers(const string& line,
                        list<uint64_t>& stones)
 {
-	const auto tokens = StringUtils::tokenize(line, ' ', true, true);
+	for(const auto& token : Tokenizer(line, ' ', true, true))
+		stones.push_back(ParseUtils::toInteger<uint64_t>(token));
 
-	AOC_ENFORCE(tokens.size() > 0);
-
-	for(const auto& token : tokens)
-		stones.push_back(stoll(token));
+	AOC_ENFORCE(stones.size() > 0);
 }
 
 void parseStoneNumbers2(const string& line,
                         map<uint64_t, uint64_t>& stones)
 {
-	const auto tokens = StringUtils::tokenize(line, ' ', true, true);
-
-	AOC_ENFORCE(tokens.size() > 0);
+	for(const auto& token : Tokenizer(line, ' ', true, true))
+		++stones[ParseUtils::toInteger<uint64_t>(token)];
 
-	for(const auto& token : tokens)
-		++stones[stoll(token)];
+	AOC_ENFORCE(stones.size() > 0);
 }
 
 void blink(list<uint64_t>& stones)
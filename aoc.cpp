@@ -5,11 +5,38 @@
 #include "doctest/doctest.h"
 #endif
 
+#if defined(AOC_BENCHMARK)
+#include <chrono>
+#include <limits>
+#include <queue>
+#endif
+
+#include <bit>
+#include <cstring>
 #include <fstream>
 #include <regex>
 #include <sstream>
 #include <unordered_set>
 
+#if defined(__unix__) || defined(__APPLE__)
+#define AOC_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define AOC_HAS_X86_SIMD
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define AOC_TARGET_AVX2
+#else
+#define AOC_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
 using namespace fmt;
 using namespace std;
 
@@ -18,1257 +45,6102 @@ namespace aoc
 
 vector<string> loadPuzzleInput(const string& puzzleInputFilePath)
 {
-	ifstream fileStream(puzzleInputFilePath);
+	return PuzzleInput(puzzleInputFilePath).toLines();
+}
 
-	if(!fileStream.is_open())
-		panic(format("unable to open input file: \"{}\"", puzzleInputFilePath));
+// Candidates found by first/last character filtering are verified here;
+// nextPositions keeps the non-overlapping counts of each substring apart.
+struct SubstringCountingState
+{
+	void countCandidates(uint32_t mask, size_t offset, const char* data, size_t k)
+	{
+		const std::string_view substr = substrs_[k];
 
-	vector<string> input;
-	string line;
+		while(mask)
+		{
+			const size_t pos = offset + countr_zero(mask);
 
-	while(getline(fileStream, line))
-		input.push_back(line);
+			if((pos >= nextPositions_[k]) &&
+			   (memcmp(data + pos + 1, substr.data() + 1, substr.size() - 1) == 0))
+			{
+				++counts_[k];
+				nextPositions_[k] = pos + (countOverlapping_ ? 1 : substr.size());
+			}
 
-	return input;
-}
+			mask &= mask - 1;
+		}
+	}
 
-void panic(const string& message,
-           source_location sourceLocation)
+	span<const std::string_view> substrs_;
+	size_t* counts_;
+	size_t* nextPositions_;
+	bool countOverlapping_;
+};
+
+// Cells of the current row holding the first letter of the word are verified
+// here along every direction in which the word fits from that row.
+struct WordSearchState
 {
-#if defined(AOC_TEST) || defined(AOC_TEST_SOLUTION)
-	throw runtime_error(message);
-#else
-	constexpr fmt::string_view panicMessageFormat = "`{}` panicked at {}({}:{}) with message: `{}`.";
+	struct Direction
+	{
+		ptrdiff_t step_;
+		size_t xBegin_;
+		size_t xEnd_;
+	};
 
-	println(stderr,
-	        panicMessageFormat,
-	        sourceLocation.function_name(),
-	        sourceLocation.file_name(),
-	        sourceLocation.line(),
-	        sourceLocation.column(),
-	        message);
+	void countCandidates(uint32_t mask, size_t offset)
+	{
+		while(mask)
+		{
+			const size_t x = offset + countr_zero(mask);
 
-	exit(EXIT_FAILURE);
+			for(size_t k=0; k<numDirections_; ++k)
+			{
+				const Direction& direction = directions_[k];
+
+				if(x < direction.xBegin_ || x >= direction.xEnd_)
+					continue;
+
+				const char* cell = row_ + x;
+				size_t i = 1;
+
+				for(; i<word_.size(); ++i)
+				{
+					cell += direction.step_;
+
+					if(*cell != word_[i])
+						break;
+				}
+
+				if(i == word_.size())
+					++count_;
+			}
+
+			mask &= mask - 1;
+		}
+	}
+
+	std::string_view word_;
+	const char* row_;
+	Direction directions_[8];
+	size_t numDirections_;
+	size_t count_;
+};
+
+#if defined(AOC_HAS_X86_SIMD)
+
+static bool isAvx2Supported()
+{
+#if defined(_MSC_VER)
+	int cpuInfo[4];
+
+	__cpuid(cpuInfo, 1);
+
+	const bool isOsXSaveSupported = (cpuInfo[2] & (1 << 27)) != 0;
+	const bool isAvxSupported = (cpuInfo[2] & (1 << 28)) != 0;
+
+	if(!isOsXSaveSupported || !isAvxSupported || (_xgetbv(0) & 0x6) != 0x6)
+		return false;
+
+	__cpuidex(cpuInfo, 7, 0);
+
+	return (cpuInfo[1] & (1 << 5)) != 0;
+#else
+	return __builtin_cpu_supports("avx2");
 #endif
 }
 
-bool StringUtils::contains(const string& str,
-                           const string& substr)
+static void appendSetBits(uint32_t mask, size_t offset, vector<size_t>& newlineOffsets)
 {
-	return str.find(substr) != string::npos;
+	while(mask)
+	{
+		newlineOffsets.push_back(offset + countr_zero(mask));
+
+		mask &= mask - 1;
+	}
 }
 
-bool StringUtils::contains(const string& str, char ch)
+static size_t findNewlinesSse2(const char* data, size_t size, vector<size_t>& newlineOffsets)
 {
-	const size_t length = str.size();
+	const __m128i newlines = _mm_set1_epi8('\n');
 
-	for(size_t i=0; i<length; ++i)
-		if(str[i] == ch)
-			return true;
+	size_t i = 0;
 
-	return false;
+	for(; i+16<=size; i+=16)
+	{
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+
+		appendSetBits(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newlines))),
+		              i,
+		              newlineOffsets);
+	}
+
+	return i;
 }
 
-size_t StringUtils::countOverlappingSubstrings(const string& str,
-                                               const string& substr)
+AOC_TARGET_AVX2
+static size_t findNewlinesAvx2(const char* data, size_t size, vector<size_t>& newlineOffsets)
 {
-	AOC_ASSERT(!substr.empty());
+	const __m256i newlines = _mm256_set1_epi8('\n');
 
-	size_t pos = 0;
-	size_t count = 0;
+	size_t i = 0;
 
-	while((pos = str.find(substr, pos)) != string::npos)
+	for(; i+32<=size; i+=32)
 	{
-		++count;
+		const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
 
-		pos += 1;
+		appendSetBits(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, newlines))),
+		              i,
+		              newlineOffsets);
 	}
 
-	return count;
+	return i;
 }
 
-size_t StringUtils::countNonOverlappingSubstrings(const string& str,
-                                                  const string& substr)
+static size_t countBytesSse2(const uint8_t* data, size_t size, uint8_t value, size_t& count)
 {
-	AOC_ASSERT(!substr.empty());
+	const __m128i values = _mm_set1_epi8(static_cast<char>(value));
 
-	size_t pos = 0;
-	size_t count = 0;
+	size_t i = 0;
 
-	while((pos = str.find(substr, pos)) != string::npos)
+	for(; i+16<=size; i+=16)
 	{
-		++count;
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
 
-		pos += substr.length();
+		count += popcount(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, values))));
 	}
 
-	return count;
+	return i;
 }
 
-string StringUtils::replaceFirst(const string& str,
-                                 const string& substr,
-                                 const string& substr2)
+AOC_TARGET_AVX2
+static size_t countBytesAvx2(const uint8_t* data, size_t size, uint8_t value, size_t& count)
 {
-	AOC_ASSERT(!substr.empty());
-	AOC_ASSERT(!substr2.empty());
+	const __m256i values = _mm256_set1_epi8(static_cast<char>(value));
 
-	auto result = str;
-	auto pos = result.find(substr);
+	size_t i = 0;
 
-	if(pos != string::npos)
-		result.replace(pos, substr.size(), substr2);
+	for(; i+32<=size; i+=32)
+	{
+		const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
 
-	return result;
+		count += popcount(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, values))));
+	}
+
+	return i;
 }
 
-string StringUtils::replaceLast(const string& str,
-                                const string& substr,
-                                const string& substr2)
+// Returns the offset of the first match, or where the scalar tail has to
+// continue if no chunk contains one.
+static size_t findAnyByteSse2(const uint8_t* data, size_t size, span<const uint8_t> values)
 {
-	AOC_ASSERT(!substr.empty());
-	AOC_ASSERT(!substr2.empty());
+	size_t i = 0;
 
-	auto result = str;
-	auto pos = result.rfind(substr);
+	for(; i+16<=size; i+=16)
+	{
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
 
-	if(pos != string::npos)
-		result.replace(pos, substr.size(), substr2);
+		__m128i isAny = _mm_setzero_si128();
 
-	return result;
-}
+		for(uint8_t value : values)
+			isAny = _mm_or_si128(isAny, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(static_cast<char>(value))));
 
-string StringUtils::replaceAll(const string& str,
-                               const string& substr,
-                               const string& substr2)
-{
-	AOC_ASSERT(!substr.empty());
-	AOC_ASSERT(!substr2.empty());
+		const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(isAny));
 
-	return regex_replace(str, regex(substr), substr2);
-}
+		if(mask)
+			return i + countr_zero(mask);
+	}
 
-string StringUtils::trim(const string& str)
-{
-	return ltrim(rtrim(str));
+	return i;
 }
 
-string StringUtils::ltrim(const string& str)
+AOC_TARGET_AVX2
+static size_t findAnyByteAvx2(const uint8_t* data, size_t size, span<const uint8_t> values)
 {
-	static const regex lhsWhitespaceRegex{"^[[:space:]]*",
-	                                      regex_constants::extended};
+	size_t i = 0;
 
-	return regex_replace(str, lhsWhitespaceRegex, "");
-}
+	for(; i+32<=size; i+=32)
+	{
+		const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
 
-string StringUtils::rtrim(const string& str)
-{
-	static const regex rhsWhitespaceRegex{"[[:space:]]*$",
-	                                      regex_constants::extended};
+		__m256i isAny = _mm256_setzero_si256();
 
-	return regex_replace(str, rhsWhitespaceRegex, "");
-}
+		for(uint8_t value : values)
+			isAny = _mm256_or_si256(isAny, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(static_cast<char>(value))));
 
-string StringUtils::trim(string str, char ch)
-{
-	return ltrim(rtrim(str, ch), ch);
-}
+		const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(isAny));
 
-string StringUtils::ltrim(string str, char ch)
-{
-	str.erase(str.begin(),
-	          find_if(str.begin(),
-	                  str.end(),
-	                  [&ch](char ch2) { return !(ch == ch2); }));
+		if(mask)
+			return i + countr_zero(mask);
+	}
 
-	return str;
+	return i;
 }
 
-string StringUtils::rtrim(string str, char ch)
+static size_t countSubstringsSse2(const char* data, size_t size, size_t maxSubstrSize, SubstringCountingState& state)
 {
-	str.erase(find_if(str.rbegin(),
-	                  str.rend(),
-	                  [&ch](unsigned char ch2) { return !(ch2 == ch); }).base(),
-	          str.end());
+	size_t i = 0;
 
-	return str;
-}
+	for(; i+16+maxSubstrSize-1<=size; i+=16)
+	{
+		const __m128i firstChunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
 
-vector<string> StringUtils::tokenize(const string& str,
-                                     char delimiter,
-                                     bool trimWhitespace,
-                                     bool skipEmptyTokens)
-{
-	vector<string> tokens;
-	stringstream sin{str};
-	string token;
+		for(size_t k=0; k<state.substrs_.size(); ++k)
+		{
+			const std::string_view substr = state.substrs_[k];
+			const __m128i lastChunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + substr.size() - 1));
+			const __m128i isFirst = _mm_cmpeq_epi8(firstChunk, _mm_set1_epi8(substr.front()));
+			const __m128i isLast = _mm_cmpeq_epi8(lastChunk, _mm_set1_epi8(substr.back()));
 
-	while(getline(sin, token, delimiter))
-		if(!skipEmptyTokens)
-			tokens.push_back(trimWhitespace ? trim(token) : token);
-		else
-			if(!token.empty())
-				tokens.push_back(trimWhitespace ? trim(token) : token);
+			state.countCandidates(static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(isFirst, isLast))), i, data, k);
+		}
+	}
 
-	return tokens;
+	return i;
 }
 
-void StringUtils::generateVariations(const set<char>& elements,
-                                     size_t k,
-                                     vector<string>& variations)
+AOC_TARGET_AVX2
+static size_t countSubstringsAvx2(const char* data, size_t size, size_t maxSubstrSize, SubstringCountingState& state)
 {
-	generateVariations(elements, k, 0, "", variations);
-}
+	size_t i = 0;
 
-void StringUtils::generateVariations(const set<char>& elements,
-                                     size_t k,
-                                     size_t i,
-                                     string sequence,
-                                     vector<string>& variations)
-{
-	if(k == i)
+	for(; i+32+maxSubstrSize-1<=size; i+=32)
 	{
-		AOC_ASSERT(sequence.size() == k);
+		const __m256i firstChunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
 
-		variations.push_back(sequence);
+		for(size_t k=0; k<state.substrs_.size(); ++k)
+		{
+			const std::string_view substr = state.substrs_[k];
+			const __m256i lastChunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + substr.size() - 1));
+			const __m256i isFirst = _mm256_cmpeq_epi8(firstChunk, _mm256_set1_epi8(substr.front()));
+			const __m256i isLast = _mm256_cmpeq_epi8(lastChunk, _mm256_set1_epi8(substr.back()));
 
-		return;
+			state.countCandidates(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(isFirst, isLast))), i, data, k);
+		}
 	}
 
-	for(char element : elements)
+	return i;
+}
+
+static size_t findWordStartsSse2(const char* row, size_t size, WordSearchState& state)
+{
+	const __m128i firstLetters = _mm_set1_epi8(state.word_.front());
+
+	size_t i = 0;
+
+	for(; i+16<=size; i+=16)
 	{
-		generateVariations(elements, k, i + 1, sequence + element, variations);
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i));
+
+		state.countCandidates(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, firstLetters))), i);
 	}
+
+	return i;
 }
 
-} // namespace aoc
+AOC_TARGET_AVX2
+static size_t findWordStartsAvx2(const char* row, size_t size, WordSearchState& state)
+{
+	const __m256i firstLetters = _mm256_set1_epi8(state.word_.front());
 
-#if defined(AOC_TEST)
+	size_t i = 0;
 
-TEST_CASE("isEven")
-{
-	CHECK(!aoc::isEven(1));
-	CHECK( aoc::isEven(2));
+	for(; i+32<=size; i+=32)
+	{
+		const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i));
+
+		state.countCandidates(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, firstLetters))), i);
+	}
+
+	return i;
 }
 
-TEST_CASE("isOdd")
+// Every window position starting at x = i..i+15 is tested at once: a cell of
+// the pattern at (x_, y_) compares 16 consecutive bytes of its grid row.
+static size_t countPatternMatchesSse2(const char* window, size_t stride, size_t numPositions,
+                                      span<const GridPattern::Cell> cells, size_t& count)
 {
-	CHECK( aoc::isOdd(1));
-	CHECK(!aoc::isOdd(2));
+	size_t i = 0;
+
+	for(; i+16<=numPositions; i+=16)
+	{
+		uint32_t mask = 0xffff;
+
+		for(const auto& cell : cells)
+		{
+			const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(window + cell.y_ * stride + cell.x_ + i));
+
+			mask &= static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(cell.ch_))));
+		}
+
+		count += popcount(mask);
+	}
+
+	return i;
 }
 
-TEST_CASE("BoundedGrid2D<char>")
+AOC_TARGET_AVX2
+static size_t countPatternMatchesAvx2(const char* window, size_t stride, size_t numPositions,
+                                      span<const GridPattern::Cell> cells, size_t& count)
 {
-	SUBCASE("smoke")
+	size_t i = 0;
+
+	for(; i+32<=numPositions; i+=32)
 	{
-		aoc::BoundedGrid2D<char> grid(7, 13, ' ');
+		uint32_t mask = 0xffffffff;
 
-		CHECK(grid.width() == 7);
-		CHECK(grid.height() == 13);
+		for(const auto& cell : cells)
+		{
+			const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(window + cell.y_ * stride + cell.x_ + i));
 
-		for(size_t y=0; y<grid.height(); ++y)
-			for(size_t x=0; x<grid.width(); ++x)
-				CHECK(grid.cell(x, y) == ' ');
+			mask &= static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(cell.ch_))));
+		}
+
+		count += popcount(mask);
 	}
 
-	SUBCASE("setCells")
+	return i;
+}
+
+// Steps the cells of a row by a life-like rule, 16 cells at a time: every
+// alive neighbor adds -1 to a byte counter, and the negated counts are
+// matched against the birth and survival counts of the rule.
+static size_t stepLifeLikeRowSse2(const char* row, size_t stride, size_t width, char* nextRow,
+                                  const CellularAutomaton::LifeLikeRule& rule)
+{
+	const __m128i alive = _mm_set1_epi8(rule.aliveCell_);
+	const __m128i dead = _mm_set1_epi8(rule.deadCell_);
+	const __m128i aliveXorDead = _mm_set1_epi8(static_cast<char>(rule.aliveCell_ ^ rule.deadCell_));
+
+	auto isAlive = [&](const char* cells)
 	{
-		const vector<string> lines =
+		return _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(cells)), alive);
+	};
+
+	size_t x = 0;
+
+	for(; x+16<=width; x+=16)
+	{
+		const char* above = row + x - stride;
+		const char* center = row + x;
+		const char* below = row + x + stride;
+
+		__m128i negativeCount = _mm_add_epi8(_mm_add_epi8(isAlive(above - 1), isAlive(above)), isAlive(above + 1));
+
+		negativeCount = _mm_add_epi8(negativeCount, _mm_add_epi8(isAlive(center - 1), isAlive(center + 1)));
+		negativeCount = _mm_add_epi8(negativeCount, _mm_add_epi8(_mm_add_epi8(isAlive(below - 1), isAlive(below)), isAlive(below + 1)));
+
+		__m128i isBorn = _mm_setzero_si128();
+		__m128i survives = _mm_setzero_si128();
+
+		for(int n=0; n<=8; ++n)
 		{
-			"..X...",
-			".SAMX.",
-			".A..A.",
-			"XMAS.S",
-			".X....",
-		};
+			const __m128i hasCount = _mm_cmpeq_epi8(negativeCount, _mm_set1_epi8(static_cast<char>(-n)));
 
-		aoc::BoundedGrid2D<char> grid(6, 5, ' ');
+			if((rule.birthCounts_ >> n) & 1)
+				isBorn = _mm_or_si128(isBorn, hasCount);
 
-		grid.setCells(lines);
+			if((rule.survivalCounts_ >> n) & 1)
+				survives = _mm_or_si128(survives, hasCount);
+		}
 
-		const char* expectedGridStr = "..X...\n"
-		                              ".SAMX.\n"
-		                              ".A..A.\n"
-		                              "XMAS.S\n"
-		                              ".X....\n";
+		const __m128i isCellAlive = isAlive(center);
+		const __m128i isNextAlive = _mm_or_si128(_mm_and_si128(isCellAlive, survives), _mm_andnot_si128(isCellAlive, isBorn));
 
-		CHECK(grid.toString() == expectedGridStr);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(nextRow + x), _mm_xor_si128(dead, _mm_and_si128(isNextAlive, aliveXorDead)));
 	}
 
-	SUBCASE("numDiagonals")
+	return x;
+}
+
+AOC_TARGET_AVX2
+static size_t stepLifeLikeRowAvx2(const char* row, size_t stride, size_t width, char* nextRow,
+                                  const CellularAutomaton::LifeLikeRule& rule)
+{
+	const __m256i alive = _mm256_set1_epi8(rule.aliveCell_);
+	const __m256i dead = _mm256_set1_epi8(rule.deadCell_);
+	const __m256i aliveXorDead = _mm256_set1_epi8(static_cast<char>(rule.aliveCell_ ^ rule.deadCell_));
+
+	auto isAlive = [&](const char* cells) AOC_TARGET_AVX2
 	{
-		CHECK(aoc::BoundedGrid2D<int>(0, 0).numDiagonals() == 0);
-		CHECK(aoc::BoundedGrid2D<int>(1, 1).numDiagonals() == 1);
-		CHECK(aoc::BoundedGrid2D<int>(10, 0).numDiagonals() == 0);
-		CHECK(aoc::BoundedGrid2D<int>(0, 10).numDiagonals() == 0);
-		CHECK(aoc::BoundedGrid2D<int>(10, 1).numDiagonals() == 10);
-		CHECK(aoc::BoundedGrid2D<int>(1, 10).numDiagonals() == 10);
-		CHECK(aoc::BoundedGrid2D<int>(10, 5).numDiagonals() == 14);
-		CHECK(aoc::BoundedGrid2D<int>(5, 10).numDiagonals() == 14);
-		CHECK(aoc::BoundedGrid2D<int>(10, 10).numDiagonals() == 19);
-		CHECK(aoc::BoundedGrid2D<int>(3, 4).numDiagonals() == 6);
-		CHECK(aoc::BoundedGrid2D<int>(4, 3).numDiagonals() == 6);
-	}
+		return _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(cells)), alive);
+	};
 
-	SUBCASE("maxDiagonalLength")
+	size_t x = 0;
+
+	for(; x+32<=width; x+=32)
 	{
-		CHECK(aoc::BoundedGrid2D<int>(0, 0).maxDiagonalLength() == 0);
-		CHECK(aoc::BoundedGrid2D<int>(1, 1).maxDiagonalLength() == 1);
-		CHECK(aoc::BoundedGrid2D<int>(10, 0).maxDiagonalLength() == 0);
-		CHECK(aoc::BoundedGrid2D<int>(0, 10).maxDiagonalLength() == 0);
-		CHECK(aoc::BoundedGrid2D<int>(10, 1).maxDiagonalLength() == 1);
-		CHECK(aoc::BoundedGrid2D<int>(1, 10).maxDiagonalLength() == 1);
-		CHECK(aoc::BoundedGrid2D<int>(10, 5).maxDiagonalLength() == 5);
-		CHECK(aoc::BoundedGrid2D<int>(5, 10).maxDiagonalLength() == 5);
-		CHECK(aoc::BoundedGrid2D<int>(10, 10).maxDiagonalLength() == 10);
-		CHECK(aoc::BoundedGrid2D<int>(3, 4).maxDiagonalLength() == 3);
-		CHECK(aoc::BoundedGrid2D<int>(4, 3).maxDiagonalLength() == 3);
-	}
+		const char* above = row + x - stride;
+		const char* center = row + x;
+		const char* below = row + x + stride;
 
-	SUBCASE("diagonalLength")
+		__m256i negativeCount = _mm256_add_epi8(_mm256_add_epi8(isAlive(above - 1), isAlive(above)), isAlive(above + 1));
+
+		negativeCount = _mm256_add_epi8(negativeCount, _mm256_add_epi8(isAlive(center - 1), isAlive(center + 1)));
+		negativeCount = _mm256_add_epi8(negativeCount, _mm256_add_epi8(_mm256_add_epi8(isAlive(below - 1), isAlive(below)), isAlive(below + 1)));
+
+		__m256i isBorn = _mm256_setzero_si256();
+		__m256i survives = _mm256_setzero_si256();
+
+		for(int n=0; n<=8; ++n)
+		{
+			const __m256i hasCount = _mm256_cmpeq_epi8(negativeCount, _mm256_set1_epi8(static_cast<char>(-n)));
+
+			if((rule.birthCounts_ >> n) & 1)
+				isBorn = _mm256_or_si256(isBorn, hasCount);
+
+			if((rule.survivalCounts_ >> n) & 1)
+				survives = _mm256_or_si256(survives, hasCount);
+		}
+
+		const __m256i isCellAlive = isAlive(center);
+		const __m256i isNextAlive = _mm256_or_si256(_mm256_and_si256(isCellAlive, survives), _mm256_andnot_si256(isCellAlive, isBorn));
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(nextRow + x), _mm256_xor_si256(dead, _mm256_and_si256(isNextAlive, aliveXorDead)));
+	}
+
+	return x;
+}
+
+// Returns a mask with a bit set for every byte of chunk that is not one of
+// ' ', '\t', '\n', '\v', '\f' or '\r' (the [[:space:]] class).
+static uint32_t nonWhitespaceMaskSse2(__m128i chunk)
+{
+	const __m128i isSpace = _mm_cmpeq_epi8(chunk, _mm_set1_epi8(' '));
+	const __m128i isAtLeastTab = _mm_cmpeq_epi8(_mm_max_epu8(chunk, _mm_set1_epi8('\t')), chunk);
+	const __m128i isAtMostCarriageReturn = _mm_cmpeq_epi8(_mm_min_epu8(chunk, _mm_set1_epi8('\r')), chunk);
+	const __m128i isWhitespace = _mm_or_si128(isSpace, _mm_and_si128(isAtLeastTab, isAtMostCarriageReturn));
+
+	return ~static_cast<uint32_t>(_mm_movemask_epi8(isWhitespace)) & 0xFFFF;
+}
+
+static size_t skipLeadingWhitespaceSse2(const char* data, size_t size)
+{
+	size_t i = 0;
+
+	for(; i+16<=size; i+=16)
 	{
-		//    345
-		// 2 ....
-		// 1 ....
-		// 0 ....
-		//
-		// 0 ....
-		// 1 ....
-		// 2 ....
-		//    345
-		aoc::BoundedGrid2D<char> grid4x3(4, 3, '.');
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
 
-		CHECK(grid4x3.diagonalLength(0) == 1);
-		CHECK(grid4x3.diagonalLength(1) == 2);
-		CHECK(grid4x3.diagonalLength(2) == 3);
-		CHECK(grid4x3.diagonalLength(3) == 3);
-		CHECK(grid4x3.diagonalLength(4) == 2);
-		CHECK(grid4x3.diagonalLength(5) == 1);
+		if(const uint32_t mask = nonWhitespaceMaskSse2(chunk); mask != 0)
+			return i + countr_zero(mask);
+	}
 
-		//    45
-		// 3 ...
-		// 2 ...
-		// 1 ...
-		// 0 ...
-		//
-		// 0 ...
-		// 1 ...
-		// 2 ...
-		// 3 ...
-		//    45
-		aoc::BoundedGrid2D<char> grid3x4(3, 4, '.');
+	return i;
+}
 
-		CHECK(grid3x4.diagonalLength(0) == 1);
-		CHECK(grid3x4.diagonalLength(1) == 2);
-		CHECK(grid3x4.diagonalLength(2) == 3);
-		CHECK(grid3x4.diagonalLength(3) == 3);
-		CHECK(grid3x4.diagonalLength(4) == 2);
-		CHECK(grid3x4.diagonalLength(5) == 1);
+static size_t skipTrailingWhitespaceSse2(const char* data, size_t size)
+{
+	size_t i = size;
 
-		//    1234
-		// 0 .....
-		//
-		// 0 .....
-		//    1234
-		aoc::BoundedGrid2D<char> grid5x1(5, 1, '.');
+	for(; i>=16; i-=16)
+	{
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i - 16));
 
-		CHECK(grid5x1.diagonalLength(0) == 1);
-		CHECK(grid5x1.diagonalLength(1) == 1);
-		CHECK(grid5x1.diagonalLength(2) == 1);
-		CHECK(grid5x1.diagonalLength(3) == 1);
-		CHECK(grid5x1.diagonalLength(4) == 1);
+		if(const uint32_t mask = nonWhitespaceMaskSse2(chunk); mask != 0)
+			return i - 16 + bit_width(mask);
+	}
 
-		// 4 .
-		// 3 .
-		// 2 .
-		// 1 .
-		// 0 .
-		//
-		// 0 .
-		// 1 .
-		// 2 .
-		// 3 .
-		// 4 .
-		aoc::BoundedGrid2D<char> grid1x5(1, 5, '.');
+	return i;
+}
 
-		CHECK(grid1x5.diagonalLength(0) == 1);
-		CHECK(grid1x5.diagonalLength(1) == 1);
-		CHECK(grid1x5.diagonalLength(2) == 1);
-		CHECK(grid1x5.diagonalLength(3) == 1);
-		CHECK(grid1x5.diagonalLength(4) == 1);
+#endif // #if defined(AOC_HAS_X86_SIMD)
+
+void findNewlines(std::string_view buffer, vector<size_t>& newlineOffsets)
+{
+	const char* data = buffer.data();
+	const size_t size = buffer.size();
+
+	size_t i = 0;
+
+#if defined(AOC_HAS_X86_SIMD)
+	static const bool useAvx2 = isAvx2Supported();
+
+	i = useAvx2 ? findNewlinesAvx2(data, size, newlineOffsets)
+	            : findNewlinesSse2(data, size, newlineOffsets);
+#endif
+
+	for(; i<size; ++i)
+		if(data[i] == '\n')
+			newlineOffsets.push_back(i);
+}
+
+size_t countBytes(const void* data, size_t size, uint8_t value)
+{
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+	size_t count = 0;
+	size_t i = 0;
+
+#if defined(AOC_HAS_X86_SIMD)
+	static const bool useAvx2 = isAvx2Supported();
+
+	i = useAvx2 ? countBytesAvx2(bytes, size, value, count)
+	            : countBytesSse2(bytes, size, value, count);
+#endif
+
+	for(; i<size; ++i)
+		if(bytes[i] == value)
+			++count;
+
+	return count;
+}
+
+size_t findAnyByte(const void* data, size_t size, span<const uint8_t> values)
+{
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+	size_t i = 0;
+
+#if defined(AOC_HAS_X86_SIMD)
+	static const bool useAvx2 = isAvx2Supported();
+
+	i = useAvx2 ? findAnyByteAvx2(bytes, size, values)
+	            : findAnyByteSse2(bytes, size, values);
+#endif
+
+	for(; i<size; ++i)
+		if(std::find(values.begin(), values.end(), bytes[i]) != values.end())
+			return i;
+
+	return size;
+}
+
+void splitLines(std::string_view buffer, vector<std::string_view>& lines)
+{
+	vector<size_t> newlineOffsets;
+
+	findNewlines(buffer, newlineOffsets);
+
+	lines.reserve(lines.size() + newlineOffsets.size() + 1);
+
+	auto addLine = [&](size_t startPos, size_t endPos)
+	{
+		if(endPos > startPos && buffer[endPos-1] == '\r')
+			--endPos;
+
+		lines.push_back(buffer.substr(startPos, endPos - startPos));
+	};
+
+	size_t startPos = 0;
+
+	for(size_t newlineOffset : newlineOffsets)
+	{
+		addLine(startPos, newlineOffset);
+
+		startPos = newlineOffset + 1;
 	}
 
-	SUBCASE("count")
+	if(startPos < buffer.size())
+		addLine(startPos, buffer.size());
+}
+
+PuzzleInput::PuzzleInput(const string& puzzleInputFilePath)
+{
+	load(puzzleInputFilePath);
+}
+
+PuzzleInput::PuzzleInput(PuzzleInput&& other) noexcept
+{
+	*this = std::move(other);
+}
+
+PuzzleInput& PuzzleInput::operator=(PuzzleInput&& other) noexcept
+{
+	if(this != &other)
 	{
+		clear();
+
+		// string_views in lines_ stay valid: they point either into the
+		// mapping or into the heap block owned by buffer_, none of which
+		// moves here.
+		data_ = other.data_;
+		dataSize_ = other.dataSize_;
+		mapping_ = other.mapping_;
+		mappingSize_ = other.mappingSize_;
+		buffer_ = std::move(other.buffer_);
+		lines_ = std::move(other.lines_);
+
+		other.data_ = nullptr;
+		other.dataSize_ = 0;
+		other.mapping_ = nullptr;
+		other.mappingSize_ = 0;
+		other.buffer_.clear();
+		other.lines_.clear();
 	}
 
-	SUBCASE("findCell")
+	return *this;
+}
+
+PuzzleInput::~PuzzleInput()
+{
+	clear();
+}
+
+void PuzzleInput::load(const string& puzzleInputFilePath)
+{
+	clear();
+
+#if defined(AOC_HAS_MMAP)
+	const int fd = open(puzzleInputFilePath.c_str(), O_RDONLY);
+
+	if(fd == -1)
+		panic(format("unable to open input file: \"{}\"", puzzleInputFilePath));
+
+	struct stat fileStatus;
+
+	if(fstat(fd, &fileStatus) == -1)
 	{
-		const vector<string> lines =
+		close(fd);
+
+		panic(format("unable to stat input file: \"{}\"", puzzleInputFilePath));
+	}
+
+	// Pipes, FIFOs and devices report no meaningful size and cannot be
+	// mapped, so they are read through a stream like on other platforms.
+	const bool isRegularFile = S_ISREG(fileStatus.st_mode);
+	const size_t fileSize = static_cast<size_t>(fileStatus.st_size);
+
+	if(isRegularFile && (fileSize > 0))
+	{
+		void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+		if(mapping == MAP_FAILED)
 		{
-			"....#.....",
-			".........#",
-			"..........",
-			"..#.......",
-			".......#..",
-			"..........",
-			".#..^.....",
-			"........#.",
-			"#.........",
-			"......#...",
-		};
+			close(fd);
 
-		aoc::BoundedGrid2D<char> grid(lines);
+			panic(format("unable to map input file: \"{}\"", puzzleInputFilePath));
+		}
 
-		CHECK(grid.findCell('^') == aoc::Point2uz(4, 6));
+		madvise(mapping, fileSize, MADV_SEQUENTIAL);
+
+		mapping_ = mapping;
+		mappingSize_ = fileSize;
+		data_ = static_cast<const char*>(mapping);
+		dataSize_ = fileSize;
 	}
 
-	SUBCASE("toString")
+	close(fd);
+
+	if(!isRegularFile)
+#endif
 	{
-		aoc::BoundedGrid2D<char> grid(4, 3, '.');
+		ifstream fileStream(puzzleInputFilePath, ios::binary);
 
-		grid.setCell(1, 0, '*');
-		grid.setCell(2, 1, '@');
-		grid.setCell(0, 2, '#');
-		grid.setCell(3, 2, '!');
+		if(!fileStream.is_open())
+			panic(format("unable to open input file: \"{}\"", puzzleInputFilePath));
 
-		const char* expectedGridStr = ".*..\n"
-		                              "..@.\n"
-		                              "#..!\n";
+		buffer_.assign(istreambuf_iterator<char>(fileStream),
+		               istreambuf_iterator<char>());
 
-		CHECK(grid.toString() == expectedGridStr);
+		data_ = buffer_.data();
+		dataSize_ = buffer_.size();
 	}
 
-	SUBCASE("row")
+	splitLines(data(), lines_);
+}
+
+void PuzzleInput::clear()
+{
+#if defined(AOC_HAS_MMAP)
+	if(mapping_)
+		munmap(mapping_, mappingSize_);
+#endif
+
+	data_ = nullptr;
+	dataSize_ = 0;
+	mapping_ = nullptr;
+	mappingSize_ = 0;
+	buffer_.clear();
+	lines_.clear();
+}
+
+vector<string> PuzzleInput::toLines() const
+{
+	return vector<string>(lines_.begin(), lines_.end());
+}
+
+LineSource::LineSource(const string& puzzleInputFilePath,
+                       size_t bufferSize)
+	: fileStream_(puzzleInputFilePath, ios::binary)
+	, buffer_(bufferSize)
+	, pos_(0)
+	, size_(0)
+	, isEndOfFile_(false)
+{
+	AOC_ASSERT(bufferSize > 0);
+
+	if(!fileStream_.is_open())
+		panic(format("unable to open input file: \"{}\"", puzzleInputFilePath));
+}
+
+bool LineSource::nextLine(std::string_view& line)
+{
+	while(true)
 	{
-		const vector<string> lines =
+		const char* lineStart = buffer_.data() + pos_;
+		const size_t numAvailableChars = size_ - pos_;
+		const char* newline = static_cast<const char*>(memchr(lineStart, '\n', numAvailableChars));
+
+		size_t lineLength = 0;
+
+		if(newline)
 		{
-			"00000000000000",
-			"11111111111111",
-			"22222222222222",
-		};
+			lineLength = newline - lineStart;
+			pos_ += lineLength + 1;
+		}
+		else if(isEndOfFile_)
+		{
+			if(numAvailableChars == 0)
+				return false;
 
-		aoc::BoundedGrid2D<char> grid(lines);
+			lineLength = numAvailableChars;
+			pos_ = size_;
+		}
+		else
+		{
+			refill();
 
-		CHECK(grid.row(0).toString() == "00000000000000");
-		CHECK(grid.row(1).toString() == "11111111111111");
-		CHECK(grid.row(2).toString() == "22222222222222");
+			continue;
+		}
+
+		if(lineLength > 0 && lineStart[lineLength-1] == '\r')
+			--lineLength;
+
+		line = std::string_view(lineStart, lineLength);
+
+		return true;
+	}
+}
+
+void LineSource::refill()
+{
+	const size_t numPendingChars = size_ - pos_;
+
+	memmove(buffer_.data(), buffer_.data() + pos_, numPendingChars);
+
+	pos_ = 0;
+	size_ = numPendingChars;
+
+	if(size_ == buffer_.size())
+		buffer_.resize(buffer_.size() * 2);
+
+	fileStream_.read(buffer_.data() + size_, buffer_.size() - size_);
+
+	size_ += static_cast<size_t>(fileStream_.gcount());
+
+	if(!fileStream_)
+		isEndOfFile_ = true;
+}
+
+ReadAheadLineSource::ReadAheadLineSource(const string& puzzleInputFilePath,
+                                         size_t blockSize)
+	: fileStream_(puzzleInputFilePath, ios::binary)
+	, isStopRequested_(false)
+	, currentBlock_(nullptr)
+	, nextBlockIndex_(0)
+	, pos_(0)
+	, isLastBlockAcquired_(false)
+	, isPendingLineConsumed_(false)
+{
+	AOC_ASSERT(blockSize > 0);
+
+	if(!fileStream_.is_open())
+		panic(format("unable to open input file: \"{}\"", puzzleInputFilePath));
+
+	for(auto& block : blocks_)
+		block.data_.resize(blockSize);
+
+	readerThread_ = thread(&ReadAheadLineSource::readBlocks, this);
+}
+
+ReadAheadLineSource::~ReadAheadLineSource()
+{
+	{
+		lock_guard<mutex> lock(mutex_);
+
+		isStopRequested_ = true;
+	}
+
+	blockReleased_.notify_one();
+
+	readerThread_.join();
+}
+
+bool ReadAheadLineSource::nextLine(std::string_view& line)
+{
+	if(isPendingLineConsumed_)
+	{
+		pendingLine_.clear();
+
+		isPendingLineConsumed_ = false;
+	}
+
+	while(true)
+	{
+		if(currentBlock_)
+		{
+			const char* lineStart = currentBlock_->data_.data() + pos_;
+			const size_t numAvailableChars = currentBlock_->size_ - pos_;
+			const char* newline = static_cast<const char*>(memchr(lineStart, '\n', numAvailableChars));
+
+			if(newline)
+			{
+				const size_t lineLength = newline - lineStart;
+
+				pos_ += lineLength + 1;
+
+				if(pendingLine_.empty())
+				{
+					line = std::string_view(lineStart, lineLength);
+				}
+				else
+				{
+					pendingLine_.append(lineStart, lineLength);
+
+					line = pendingLine_;
+					isPendingLineConsumed_ = true;
+				}
+
+				break;
+			}
+
+			pendingLine_.append(lineStart, numAvailableChars);
+
+			releaseCurrentBlock();
+		}
+
+		if(!acquireNextBlock())
+		{
+			if(pendingLine_.empty())
+				return false;
+
+			line = pendingLine_;
+			isPendingLineConsumed_ = true;
+
+			break;
+		}
+	}
+
+	if(!line.empty() && line.back() == '\r')
+		line.remove_suffix(1);
+
+	return true;
+}
+
+void ReadAheadLineSource::readBlocks()
+{
+	for(size_t blockIndex=0; ; blockIndex^=1)
+	{
+		Block& block = blocks_[blockIndex];
+
+		{
+			unique_lock<mutex> lock(mutex_);
+
+			blockReleased_.wait(lock, [&]() { return !block.isFilled_ || isStopRequested_; });
+
+			if(isStopRequested_)
+				return;
+		}
+
+		fileStream_.read(block.data_.data(), block.data_.size());
+
+		block.size_ = static_cast<size_t>(fileStream_.gcount());
+		block.isLast_ = !fileStream_;
+
+		{
+			lock_guard<mutex> lock(mutex_);
+
+			block.isFilled_ = true;
+		}
+
+		blockFilled_.notify_one();
+
+		if(block.isLast_)
+			return;
+	}
+}
+
+bool ReadAheadLineSource::acquireNextBlock()
+{
+	AOC_ASSERT(!currentBlock_);
+
+	if(isLastBlockAcquired_)
+		return false;
+
+	Block& block = blocks_[nextBlockIndex_];
+
+	{
+		unique_lock<mutex> lock(mutex_);
+
+		blockFilled_.wait(lock, [&]() { return block.isFilled_; });
+	}
+
+	currentBlock_ = &block;
+	nextBlockIndex_ ^= 1;
+	pos_ = 0;
+	isLastBlockAcquired_ = block.isLast_;
+
+	return true;
+}
+
+void ReadAheadLineSource::releaseCurrentBlock()
+{
+	AOC_ASSERT(currentBlock_);
+
+	{
+		lock_guard<mutex> lock(mutex_);
+
+		currentBlock_->isFilled_ = false;
+	}
+
+	blockReleased_.notify_one();
+
+	currentBlock_ = nullptr;
+}
+
+void panic(const string& message,
+           source_location sourceLocation)
+{
+#if defined(AOC_TEST) || defined(AOC_TEST_SOLUTION)
+	throw runtime_error(message);
+#else
+	constexpr fmt::string_view panicMessageFormat = "`{}` panicked at {}({}:{}) with message: `{}`.";
+
+	println(stderr,
+	        panicMessageFormat,
+	        sourceLocation.function_name(),
+	        sourceLocation.file_name(),
+	        sourceLocation.line(),
+	        sourceLocation.column(),
+	        message);
+
+	exit(EXIT_FAILURE);
+#endif
+}
+
+void ParseUtils::skipWhitespace(std::string_view str, size_t& pos)
+{
+	while((pos < str.size()) && isWhitespace(str[pos]))
+		++pos;
+}
+
+void ParseUtils::skipDelimiters(std::string_view str, size_t& pos, std::string_view delimiters)
+{
+	while((pos < str.size()) && (delimiters.find(str[pos]) != std::string_view::npos))
+		++pos;
+}
+
+bool ParseUtils::skipChar(std::string_view str, size_t& pos, char ch)
+{
+	if((pos < str.size()) && (str[pos] == ch))
+	{
+		++pos;
+		return true;
+	}
+
+	return false;
+}
+
+Tokenizer::Iterator::Iterator(const Tokenizer* tokenizer)
+	: tokenizer_(tokenizer)
+{
+	advance();
+}
+
+// Mirrors a getline loop: a delimiter ending the string does not start
+// another (empty) token, and emptiness is checked before trimming.
+void Tokenizer::Iterator::advance()
+{
+	const std::string_view str = tokenizer_->str_;
+
+	while(nextTokenPos_ < str.size())
+	{
+		size_t delimiterPos = str.find(tokenizer_->delimiter_, nextTokenPos_);
+
+		if(delimiterPos == std::string_view::npos)
+			delimiterPos = str.size();
+
+		tokenPos_ = nextTokenPos_;
+		token_ = str.substr(tokenPos_, delimiterPos - tokenPos_);
+		nextTokenPos_ = delimiterPos + 1;
+
+		if(tokenizer_->skipEmptyTokens_ && token_.empty())
+			continue;
+
+		if(tokenizer_->trimWhitespace_)
+			token_ = StringUtils::trimView(token_);
+
+		return;
+	}
+
+	tokenPos_ = std::string_view::npos;
+	token_ = std::string_view();
+}
+
+LiteralReplacer::LiteralReplacer(const vector<pair<string, string>>& replacements)
+{
+	addState();
+
+	// Build the trie; missing transitions are marked with the root's index
+	// since no edge ever leads back to the root.
+	for(const auto& [pattern, replacement] : replacements)
+	{
+		AOC_ENFORCE_MSG(!pattern.empty(), "empty patterns cannot be replaced");
+
+		uint32_t state = 0;
+
+		for(const unsigned char ch : pattern)
+		{
+			if(transitions_[state * alphabetSize + ch] == 0)
+			{
+				const uint32_t newState = addState();
+
+				transitions_[state * alphabetSize + ch] = newState;
+			}
+
+			state = transitions_[state * alphabetSize + ch];
+		}
+
+		if(matches_[state].patternLength_ == 0)
+		{
+			matches_[state].patternLength_ = static_cast<uint32_t>(pattern.size());
+			matches_[state].replacementIndex_ = static_cast<uint32_t>(replacements_.size());
+		}
+
+		replacements_.push_back(replacement);
+	}
+
+	// Turn the trie into a DFA in breadth-first order, so that the failure
+	// state of every state is complete by the time it is needed. A state
+	// not ending a pattern itself inherits the longest pattern that is a
+	// suffix of it from its failure state.
+	vector<uint32_t> failureStates(matches_.size(), 0);
+	vector<uint32_t> queue;
+
+	queue.reserve(matches_.size());
+
+	for(size_t ch=0; ch<alphabetSize; ++ch)
+		if(const uint32_t nextState = transitions_[ch]; nextState != 0)
+			queue.push_back(nextState);
+
+	for(size_t i=0; i<queue.size(); ++i)
+	{
+		const uint32_t state = queue[i];
+		const uint32_t failureState = failureStates[state];
+
+		if(matches_[state].patternLength_ == 0)
+			matches_[state] = matches_[failureState];
+
+		for(size_t ch=0; ch<alphabetSize; ++ch)
+		{
+			uint32_t& nextState = transitions_[state * alphabetSize + ch];
+			const uint32_t failureNextState = transitions_[failureState * alphabetSize + ch];
+
+			if(nextState != 0)
+			{
+				failureStates[nextState] = failureNextState;
+				queue.push_back(nextState);
+			}
+			else
+				nextState = failureNextState;
+		}
+	}
+}
+
+uint32_t LiteralReplacer::addState()
+{
+	const uint32_t state = static_cast<uint32_t>(matches_.size());
+
+	transitions_.resize(transitions_.size() + alphabetSize, 0);
+	matches_.emplace_back();
+
+	return state;
+}
+
+void LiteralReplacer::replaceAll(std::string_view str, string& result) const
+{
+	result.clear();
+
+	const uint32_t* transitions = transitions_.data();
+	uint32_t state = 0;
+	size_t copiedPos = 0;
+
+	for(size_t i=0; i<str.size(); ++i)
+	{
+		state = transitions[state * alphabetSize + static_cast<unsigned char>(str[i])];
+
+		if(const Match& match = matches_[state]; match.patternLength_ != 0)
+		{
+			const size_t matchPos = i + 1 - match.patternLength_;
+
+			AOC_ASSERT(matchPos >= copiedPos);
+
+			result.append(str.substr(copiedPos, matchPos - copiedPos));
+			result.append(replacements_[match.replacementIndex_]);
+
+			copiedPos = i + 1;
+			state = 0;
+		}
+	}
+
+	result.append(str.substr(copiedPos));
+}
+
+string LiteralReplacer::replaceAll(std::string_view str) const
+{
+	string result;
+
+	replaceAll(str, result);
+
+	return result;
+}
+
+Variations::Iterator::Iterator(const Variations* variations, size_t ordinal)
+	: variations_(variations)
+	, ordinal_(ordinal)
+	, variation_(variations->k_, '\0')
+{
+	AOC_ASSERT(ordinal <= variations->size_);
+
+	if(ordinal < variations->size_)
+		variations->variation(ordinal, variation_);
+}
+
+// Advances like an odometer: the last position turns fastest, and a
+// position wrapping around to the first element carries into the one
+// before it.
+Variations::Iterator& Variations::Iterator::operator++()
+{
+	AOC_ASSERT(ordinal_ < variations_->size_);
+
+	++ordinal_;
+
+	for(size_t i=variation_.size(); i-->0;)
+	{
+		const char element = variation_[i];
+
+		variation_[i] = variations_->nextElements_[static_cast<unsigned char>(element)];
+
+		if(element != variations_->elements_.back())
+			break;
+	}
+
+	return *this;
+}
+
+Variations::Variations(const set<char>& elements, size_t k)
+	: elements_(elements.begin(), elements.end())
+	, k_(k)
+	, size_(1)
+{
+	for(size_t i=0; i<k; ++i)
+	{
+		AOC_ENFORCE_MSG(elements_.empty() || size_ <= numeric_limits<size_t>::max() / elements_.size(),
+		                "too many variations");
+
+		size_ *= elements_.size();
+	}
+
+	for(size_t i=0; i<elements_.size(); ++i)
+		nextElements_[static_cast<unsigned char>(elements_[i])] = elements_[(i + 1) % elements_.size()];
+}
+
+void Variations::variation(size_t ordinal, span<char> variation) const
+{
+	AOC_ASSERT(ordinal < size_);
+	AOC_ASSERT(variation.size() == k_);
+
+	for(size_t i=k_; i-->0;)
+	{
+		variation[i] = elements_[ordinal % elements_.size()];
+		ordinal /= elements_.size();
+	}
+}
+
+string Variations::operator[](size_t ordinal) const
+{
+	string result(k_, '\0');
+
+	variation(ordinal, result);
+
+	return result;
+}
+
+bool StringUtils::contains(const string& str,
+                           const string& substr)
+{
+	return str.find(substr) != string::npos;
+}
+
+bool StringUtils::contains(const string& str, char ch)
+{
+	const size_t length = str.size();
+
+	for(size_t i=0; i<length; ++i)
+		if(str[i] == ch)
+			return true;
+
+	return false;
+}
+
+size_t StringUtils::countOverlappingSubstrings(std::string_view str,
+                                               std::string_view substr)
+{
+	AOC_ASSERT(!substr.empty());
+
+	size_t count = 0;
+
+	countSubstrings(str, span(&substr, 1), span(&count, 1), true);
+
+	return count;
+}
+
+size_t StringUtils::countNonOverlappingSubstrings(std::string_view str,
+                                                  std::string_view substr)
+{
+	AOC_ASSERT(!substr.empty());
+
+	size_t count = 0;
+
+	countSubstrings(str, span(&substr, 1), span(&count, 1), false);
+
+	return count;
+}
+
+void StringUtils::countSubstrings(std::string_view str,
+                                  span<const std::string_view> substrs,
+                                  span<size_t> counts,
+                                  bool countOverlapping)
+{
+	AOC_ASSERT(counts.size() == substrs.size());
+
+	size_t maxSubstrSize = 0;
+
+	for(const auto& substr : substrs)
+	{
+		AOC_ASSERT(!substr.empty());
+
+		maxSubstrSize = max(maxSubstrSize, substr.size());
+	}
+
+	if(substrs.empty())
+		return;
+
+	constexpr size_t maxNumLocalSubstrs = 8;
+
+	size_t localNextPositions[maxNumLocalSubstrs] = {};
+	vector<size_t> nextPositionsBuffer;
+	size_t* nextPositions = localNextPositions;
+
+	if(substrs.size() > maxNumLocalSubstrs)
+	{
+		nextPositionsBuffer.resize(substrs.size(), 0);
+		nextPositions = nextPositionsBuffer.data();
+	}
+
+	SubstringCountingState state{ substrs, counts.data(), nextPositions, countOverlapping };
+
+	const char* data = str.data();
+	const size_t size = str.size();
+
+	size_t i = 0;
+
+#if defined(AOC_HAS_X86_SIMD)
+	static const bool useAvx2 = isAvx2Supported();
+
+	i = useAvx2 ? countSubstringsAvx2(data, size, maxSubstrSize, state)
+	            : countSubstringsSse2(data, size, maxSubstrSize, state);
+#endif
+
+	for(; i<size; ++i)
+	{
+		for(size_t k=0; k<substrs.size(); ++k)
+		{
+			const std::string_view substr = substrs[k];
+
+			if((i + substr.size() <= size) &&
+			   (data[i] == substr.front()) &&
+			   (data[i + substr.size() - 1] == substr.back()))
+				state.countCandidates(1, i, data, k);
+		}
+	}
+}
+
+string StringUtils::replaceFirst(const string& str,
+                                 const string& substr,
+                                 const string& substr2)
+{
+	AOC_ASSERT(!substr.empty());
+	AOC_ASSERT(!substr2.empty());
+
+	auto result = str;
+	auto pos = result.find(substr);
+
+	if(pos != string::npos)
+		result.replace(pos, substr.size(), substr2);
+
+	return result;
+}
+
+string StringUtils::replaceLast(const string& str,
+                                const string& substr,
+                                const string& substr2)
+{
+	AOC_ASSERT(!substr.empty());
+	AOC_ASSERT(!substr2.empty());
+
+	auto result = str;
+	auto pos = result.rfind(substr);
+
+	if(pos != string::npos)
+		result.replace(pos, substr.size(), substr2);
+
+	return result;
+}
+
+string StringUtils::replaceAll(const string& str,
+                               const string& substr,
+                               const string& substr2)
+{
+	AOC_ASSERT(!substr.empty());
+	AOC_ASSERT(!substr2.empty());
+
+	string result;
+
+	replaceAll(str, substr, substr2, result);
+
+	return result;
+}
+
+void StringUtils::replaceAll(std::string_view str,
+                             std::string_view substr,
+                             std::string_view substr2,
+                             string& result)
+{
+	AOC_ASSERT(!substr.empty());
+
+	result.clear();
+
+	size_t copiedPos = 0;
+
+	for(size_t pos=str.find(substr); pos!=std::string_view::npos; pos=str.find(substr, copiedPos))
+	{
+		result.append(str.substr(copiedPos, pos - copiedPos));
+		result.append(substr2);
+
+		copiedPos = pos + substr.size();
+	}
+
+	result.append(str.substr(copiedPos));
+}
+
+string StringUtils::trim(const string& str)
+{
+	return string(trimView(str));
+}
+
+string StringUtils::ltrim(const string& str)
+{
+	return string(ltrimView(str));
+}
+
+string StringUtils::rtrim(const string& str)
+{
+	return string(rtrimView(str));
+}
+
+std::string_view StringUtils::trimView(std::string_view str)
+{
+	return ltrimView(rtrimView(str));
+}
+
+// Short runs are the common case (tokens padded with a space or two), so
+// the vectorized scan only kicks in once the string starts with whitespace.
+std::string_view StringUtils::ltrimView(std::string_view str)
+{
+	size_t pos = 0;
+
+	if(str.empty() || !ParseUtils::isWhitespace(str.front()))
+		return str;
+
+#if defined(AOC_HAS_X86_SIMD)
+	pos = skipLeadingWhitespaceSse2(str.data(), str.size());
+#endif
+
+	while((pos < str.size()) && ParseUtils::isWhitespace(str[pos]))
+		++pos;
+
+	return str.substr(pos);
+}
+
+std::string_view StringUtils::rtrimView(std::string_view str)
+{
+	if(str.empty() || !ParseUtils::isWhitespace(str.back()))
+		return str;
+
+	size_t size = str.size();
+
+#if defined(AOC_HAS_X86_SIMD)
+	size = skipTrailingWhitespaceSse2(str.data(), size);
+#endif
+
+	while((size > 0) && ParseUtils::isWhitespace(str[size - 1]))
+		--size;
+
+	return str.substr(0, size);
+}
+
+string StringUtils::trim(string str, char ch)
+{
+	return ltrim(rtrim(str, ch), ch);
+}
+
+string StringUtils::ltrim(string str, char ch)
+{
+	str.erase(str.begin(),
+	          find_if(str.begin(),
+	                  str.end(),
+	                  [&ch](char ch2) { return !(ch == ch2); }));
+
+	return str;
+}
+
+string StringUtils::rtrim(string str, char ch)
+{
+	str.erase(find_if(str.rbegin(),
+	                  str.rend(),
+	                  [&ch](unsigned char ch2) { return !(ch2 == ch); }).base(),
+	          str.end());
+
+	return str;
+}
+
+vector<string> StringUtils::tokenize(const string& str,
+                                     char delimiter,
+                                     bool trimWhitespace,
+                                     bool skipEmptyTokens)
+{
+	vector<string> tokens;
+
+	for(const auto& token : Tokenizer(str, delimiter, trimWhitespace, skipEmptyTokens))
+		tokens.emplace_back(token);
+
+	return tokens;
+}
+
+size_t StringUtils::tokenize(std::string_view str,
+                             span<std::string_view> tokens,
+                             char delimiter,
+                             bool trimWhitespace,
+                             bool skipEmptyTokens)
+{
+	size_t numTokens = 0;
+
+	for(const auto& token : Tokenizer(str, delimiter, trimWhitespace, skipEmptyTokens))
+	{
+		if(numTokens < tokens.size())
+			tokens[numTokens] = token;
+
+		++numTokens;
+	}
+
+	return numTokens;
+}
+
+void StringUtils::generateVariations(const set<char>& elements,
+                                     size_t k,
+                                     vector<string>& variations)
+{
+	const Variations allVariations(elements, k);
+
+	variations.reserve(variations.size() + allVariations.size());
+
+	for(const auto& variation : allVariations)
+		variations.emplace_back(variation);
+}
+
+size_t GridWordSearch::countWord(const BoundedGrid2D<char>& grid,
+                                 std::string_view word,
+                                 DirectionMask directions)
+{
+	AOC_ASSERT(!word.empty());
+
+	const size_t width = grid.width();
+	const size_t height = grid.height();
+	const size_t reach = word.size() - 1;
+
+	// Start cells are limited per direction so that the whole word stays
+	// inside the grid; the rows are limited here, the columns per candidate.
+	struct DirectionRange
+	{
+		WordSearchState::Direction direction_;
+		size_t yBegin_;
+		size_t yEnd_;
+	};
+
+	DirectionRange directionRanges[8];
+	size_t numDirectionRanges = 0;
+
+	for(size_t d=0; d<8; ++d)
+	{
+		if(!(directions & directionMask(static_cast<CompassDirection>(d))))
+			continue;
+
+		const Point2i delta = compassDeltaPositionFor[d];
+
+		if((delta.x_ != 0 && reach >= width) ||
+		   (delta.y_ != 0 && reach >= height))
+			continue;
+
+		directionRanges[numDirectionRanges++] =
+		{
+			{
+				delta.y_ * static_cast<ptrdiff_t>(grid.rowStride()) + delta.x_,
+				(delta.x_ < 0) ? reach : 0,
+				(delta.x_ > 0) ? width - reach : width,
+			},
+			(delta.y_ < 0) ? reach : 0,
+			(delta.y_ > 0) ? height - reach : height,
+		};
+	}
+
+	WordSearchState state{ word, nullptr, {}, 0, 0 };
+
+#if defined(AOC_HAS_X86_SIMD)
+	static const bool useAvx2 = isAvx2Supported();
+#endif
+
+	for(size_t y=0; y<height; ++y)
+	{
+		state.row_ = grid.data() + y * grid.rowStride();
+		state.numDirections_ = 0;
+
+		for(size_t k=0; k<numDirectionRanges; ++k)
+		{
+			if(y >= directionRanges[k].yBegin_ && y < directionRanges[k].yEnd_)
+				state.directions_[state.numDirections_++] = directionRanges[k].direction_;
+		}
+
+		if(state.numDirections_ == 0)
+			continue;
+
+		size_t x = 0;
+
+#if defined(AOC_HAS_X86_SIMD)
+		x = useAvx2 ? findWordStartsAvx2(state.row_, width, state)
+		            : findWordStartsSse2(state.row_, width, state);
+#endif
+
+		for(; x<width; ++x)
+		{
+			if(state.row_[x] == word.front())
+				state.countCandidates(1, x);
+		}
+	}
+
+	return state.count_;
+}
+
+GridPattern::GridPattern(const vector<string>& rows,
+                         char wildcard,
+                         Transformations transformations)
+{
+	AOC_ASSERT(!rows.empty() && !rows[0].empty());
+
+	AOC_ASSERT(std::all_of(rows.begin(), rows.end(), [&](const string& row) { return row.size() == rows[0].size(); }));
+
+	auto rotate = [](const vector<string>& pattern)
+	{
+		const size_t height = pattern.size();
+
+		vector<string> rotated(pattern[0].size(), string(height, ' '));
+
+		for(size_t y=0; y<rotated.size(); ++y)
+			for(size_t x=0; x<height; ++x)
+				rotated[y][x] = pattern[height - 1 - x][y];
+
+		return rotated;
+	};
+
+	auto reflect = [](vector<string> pattern)
+	{
+		for(auto& row : pattern)
+			std::reverse(row.begin(), row.end());
+
+		return pattern;
+	};
+
+	vector<vector<string>> patterns = { rows };
+
+	if(transformations & rotations)
+	{
+		for(size_t i=0; i<3; ++i)
+			patterns.push_back(rotate(patterns.back()));
+	}
+
+	if(transformations & reflections)
+	{
+		const size_t numUnreflected = patterns.size();
+
+		for(size_t i=0; i<numUnreflected; ++i)
+			patterns.push_back(reflect(patterns[i]));
+	}
+
+	for(size_t i=0; i<patterns.size(); ++i)
+	{
+		if(std::find(patterns.begin(), patterns.begin() + i, patterns[i]) != patterns.begin() + i)
+			continue;
+
+		Variant variant{ patterns[i][0].size(), patterns[i].size(), {} };
+
+		for(size_t y=0; y<variant.height_; ++y)
+		{
+			for(size_t x=0; x<variant.width_; ++x)
+			{
+				if(patterns[i][y][x] != wildcard)
+					variant.cells_.push_back({ x, y, patterns[i][y][x] });
+			}
+		}
+
+		variants_.push_back(std::move(variant));
+	}
+}
+
+size_t GridPattern::count(const BoundedGrid2D<char>& grid) const
+{
+	const size_t stride = grid.rowStride();
+
+	size_t count = 0;
+
+#if defined(AOC_HAS_X86_SIMD)
+	static const bool useAvx2 = isAvx2Supported();
+#endif
+
+	// Rows are the outer loop so that all variants of the pattern are matched
+	// while the rows they read are still in cache.
+	for(size_t y=0; y<grid.height(); ++y)
+	{
+		const char* window = grid.data() + y * stride;
+
+		for(const auto& variant : variants_)
+		{
+			if(y + variant.height_ > grid.height() || variant.width_ > grid.width())
+				continue;
+
+			const size_t numPositions = grid.width() - variant.width_ + 1;
+
+			size_t x = 0;
+
+#if defined(AOC_HAS_X86_SIMD)
+			x = useAvx2 ? countPatternMatchesAvx2(window, stride, numPositions, variant.cells_, count)
+			            : countPatternMatchesSse2(window, stride, numPositions, variant.cells_, count);
+#endif
+
+			for(; x<numPositions; ++x)
+			{
+				const bool isMatch = std::all_of(variant.cells_.begin(), variant.cells_.end(), [&](const Cell& cell)
+				{
+					return window[cell.y_ * stride + cell.x_ + x] == cell.ch_;
+				});
+
+				if(isMatch)
+					++count;
+			}
+		}
+	}
+
+	return count;
+}
+
+void BitGrid::reset(size_t width, size_t height, bool initCell)
+{
+	width_ = width;
+	height_ = height;
+	wordsPerRow_ = (width + bitsPerWord - 1) / bitsPerWord;
+
+	words_.assign(wordsPerRow_ * height, initCell ? ~Word(0) : Word(0));
+
+	if(initCell && wordsPerRow_ > 0)
+	{
+		for(size_t y=0; y<height; ++y)
+			words_[y * wordsPerRow_ + wordsPerRow_ - 1] &= lastWordMask();
+	}
+}
+
+void BitGrid::reset(const BoundedGrid2D<char>& grid, char setChar)
+{
+	reset(grid.width(), grid.height());
+
+	for(size_t y=0; y<height_; ++y)
+	{
+		const char* row = grid.data() + y * grid.rowStride();
+		Word* words = words_.data() + y * wordsPerRow_;
+
+		for(size_t x=0; x<width_; ++x)
+			words[x / bitsPerWord] |= Word(row[x] == setChar) << (x % bitsPerWord);
+	}
+}
+
+size_t BitGrid::count(bool cell) const
+{
+	size_t numSetCells = 0;
+
+	for(Word word : words_)
+		numSetCells += popcount(word);
+
+	return cell ? numSetCells : numCells() - numSetCells;
+}
+
+Point2uz BitGrid::findCell(bool cell) const
+{
+	for(size_t y=0; y<height_; ++y)
+	{
+		const Word* words = words_.data() + y * wordsPerRow_;
+
+		for(size_t i=0; i<wordsPerRow_; ++i)
+		{
+			Word word = cell ? words[i] : ~words[i];
+
+			if(i == wordsPerRow_ - 1)
+				word &= lastWordMask();
+
+			if(word)
+				return Point2uz(i * bitsPerWord + countr_zero(word), y);
+		}
+	}
+
+	return Point2uz(npos, npos);
+}
+
+size_t BitGrid::findFirstSetInRow(size_t y, size_t fromX) const
+{
+	AOC_ASSERT(y < height());
+
+	if(fromX >= width_)
+		return npos;
+
+	const Word* words = words_.data() + y * wordsPerRow_;
+
+	size_t i = fromX / bitsPerWord;
+
+	Word word = words[i] & (~Word(0) << (fromX % bitsPerWord));
+
+	while(!word)
+	{
+		if(++i == wordsPerRow_)
+			return npos;
+
+		word = words[i];
+	}
+
+	return i * bitsPerWord + countr_zero(word);
+}
+
+string BitGrid::toString(char setChar, char unsetChar) const
+{
+	string result;
+
+	result.reserve((width_ + 1) * height_);
+
+	for(size_t y=0; y<height_; ++y)
+	{
+		for(size_t x=0; x<width_; ++x)
+			result += cell(x, y) ? setChar : unsetChar;
+
+		result += '\n';
+	}
+
+	return result;
+}
+
+BitGrid& BitGrid::operator&=(const BitGrid& other)
+{
+	AOC_ASSERT(width_ == other.width_ && height_ == other.height_);
+
+	for(size_t i=0; i<words_.size(); ++i)
+		words_[i] &= other.words_[i];
+
+	return *this;
+}
+
+BitGrid& BitGrid::operator|=(const BitGrid& other)
+{
+	AOC_ASSERT(width_ == other.width_ && height_ == other.height_);
+
+	for(size_t i=0; i<words_.size(); ++i)
+		words_[i] |= other.words_[i];
+
+	return *this;
+}
+
+BitGrid& BitGrid::operator^=(const BitGrid& other)
+{
+	AOC_ASSERT(width_ == other.width_ && height_ == other.height_);
+
+	for(size_t i=0; i<words_.size(); ++i)
+		words_[i] ^= other.words_[i];
+
+	return *this;
+}
+
+void GridTraversal::reset(size_t width, size_t height)
+{
+	AOC_ENFORCE(width * height <= std::numeric_limits<CellIndex>::max());
+
+	width_ = width;
+	height_ = height;
+
+	// The marks start out at an epoch that no traversal uses, so no cell
+	// counts as visited before the first traversal.
+	visitedIn_.assign(width * height, Epoch(0));
+	epoch_ = 1;
+
+	pending_.resize(width * height);
+	pendingBegin_ = 0;
+	pendingEnd_ = 0;
+}
+
+void GridTraversal::beginTraversal()
+{
+	// The marks of the previous traversals only have to be cleared once the
+	// epoch wraps around.
+	if(++epoch_ == 0)
+	{
+		std::fill(visitedIn_.begin(), visitedIn_.end(), Epoch(0));
+		epoch_ = 1;
+	}
+
+	pendingBegin_ = 0;
+	pendingEnd_ = 0;
+}
+
+void GridPathFinder::reset(size_t width, size_t height, Cost maxStepCost, bool isDirected, Cost turnCost)
+{
+	numDirections_ = isDirected ? 4 : 1;
+
+	AOC_ENFORCE(width * height * numDirections_ <= std::numeric_limits<StateIndex>::max());
+
+	width_ = width;
+	height_ = height;
+	maxStepCost_ = maxStepCost;
+	turnCost_ = turnCost;
+
+	distances_.assign(width * height * numDirections_, unreachable);
+}
+
+void CellularAutomaton::reset(const BoundedGrid2D<char>& grid, char outsideCell)
+{
+	cells_.reset(grid, 1, outsideCell);
+	nextCells_.reset(grid.width(), grid.height(), 1, outsideCell, outsideCell);
+	generation_ = 0;
+}
+
+size_t CellularAutomaton::count(char cell) const
+{
+	size_t count = 0;
+
+	for(size_t y=0; y<height(); ++y)
+		count += countBytes(cells_.data() + cells_.index(0, y), width(), static_cast<uint8_t>(cell));
+
+	return count;
+}
+
+BoundedGrid2D<char> CellularAutomaton::grid() const
+{
+	BoundedGrid2D<char> grid(width(), height());
+
+	for(size_t y=0; y<height(); ++y)
+		std::memcpy(grid.data() + y * grid.rowStride(), cells_.data() + cells_.index(0, y), width());
+
+	return grid;
+}
+
+void CellularAutomaton::step(const LifeLikeRule& rule, size_t numGenerations)
+{
+#if defined(AOC_HAS_X86_SIMD)
+	static const bool useAvx2 = isAvx2Supported();
+#endif
+
+	for(size_t i=0; i<numGenerations; ++i)
+	{
+		const size_t stride = cells_.rowStride();
+
+		forEachBand([&](size_t startY, size_t endY)
+		{
+			for(size_t y=startY; y<endY; ++y)
+			{
+				const char* row = cells_.data() + cells_.index(0, y);
+				char* nextRow = nextCells_.data() + nextCells_.index(0, y);
+
+				size_t x = 0;
+
+#if defined(AOC_HAS_X86_SIMD)
+				x = useAvx2 ? stepLifeLikeRowAvx2(row, stride, width(), nextRow, rule)
+				            : stepLifeLikeRowSse2(row, stride, width(), nextRow, rule);
+#endif
+
+				for(; x<width(); ++x)
+				{
+					const Neighborhood neighborhood(row + x, stride);
+					const uint16_t nextAliveCounts = (neighborhood.cell() == rule.aliveCell_) ? rule.survivalCounts_ : rule.birthCounts_;
+
+					nextRow[x] = ((nextAliveCounts >> neighborhood.count(rule.aliveCell_)) & 1) ? rule.aliveCell_ : rule.deadCell_;
+				}
+			}
+		});
+
+		swapBuffers();
+	}
+}
+
+} // namespace aoc
+
+#if defined(AOC_TEST)
+
+TEST_CASE("isEven")
+{
+	CHECK(!aoc::isEven(1));
+	CHECK( aoc::isEven(2));
+}
+
+TEST_CASE("isOdd")
+{
+	CHECK( aoc::isOdd(1));
+	CHECK(!aoc::isOdd(2));
+}
+
+TEST_CASE("PuzzleInput")
+{
+	const string puzzleInputFilePath = "aoc-test-puzzle-input.txt";
+
+	auto writeFile = [&](const string& content)
+	{
+		ofstream fileStream(puzzleInputFilePath, ios::binary);
+
+		fileStream << content;
+	};
+
+	SUBCASE("splits like getline")
+	{
+		const tuple<const char*, vector<string>> contentsAndLines[] =
+		{
+			{ "", {} },
+			{ "\n", { "" } },
+			{ "abc", { "abc" } },
+			{ "abc\n", { "abc" } },
+			{ "abc\ndef", { "abc", "def" } },
+			{ "abc\ndef\n", { "abc", "def" } },
+			{ "abc\n\ndef\n\n", { "abc", "", "def", "" } },
+			{ "abc\r\ndef\r\n", { "abc", "def" } },
+			{ "abc\r\n\r\ndef", { "abc", "", "def" } },
+		};
+
+		for(const auto& [content, lines] : contentsAndLines)
+		{
+			writeFile(content);
+
+			aoc::PuzzleInput puzzleInput(puzzleInputFilePath);
+
+			CHECK(puzzleInput.toLines() == lines);
+			CHECK(aoc::loadPuzzleInput(puzzleInputFilePath) == lines);
+			CHECK(puzzleInput.data() == content);
+		}
+	}
+
+	SUBCASE("lines")
+	{
+		writeFile("190: 10 19\n3267: 81 40 27\n83: 17 5\n");
+
+		aoc::PuzzleInput puzzleInput(puzzleInputFilePath);
+
+		CHECK(puzzleInput.size() == 3);
+		CHECK(puzzleInput[0] == "190: 10 19");
+		CHECK(puzzleInput[1] == "3267: 81 40 27");
+		CHECK(puzzleInput[2] == "83: 17 5");
+
+		aoc::PuzzleInput movedPuzzleInput(std::move(puzzleInput));
+
+		CHECK(puzzleInput.empty());
+		CHECK(movedPuzzleInput.size() == 3);
+		CHECK(*movedPuzzleInput.begin() == "190: 10 19");
+	}
+
+#if defined(AOC_HAS_MMAP)
+	SUBCASE("fifo")
+	{
+		const string fifoPath = "aoc-test-puzzle-input.fifo";
+
+		remove(fifoPath.c_str());
+
+		REQUIRE(mkfifo(fifoPath.c_str(), 0600) == 0);
+
+		// Opening a FIFO for writing blocks until it is opened for reading.
+		thread writer([&]()
+		{
+			ofstream fileStream(fifoPath, ios::binary);
+
+			fileStream << "a\nb\nc\n";
+		});
+
+		aoc::PuzzleInput puzzleInput(fifoPath);
+
+		writer.join();
+
+		CHECK(puzzleInput.toLines() == vector<string>{ "a", "b", "c" });
+
+		remove(fifoPath.c_str());
+	}
+#endif
+
+	remove(puzzleInputFilePath.c_str());
+}
+
+TEST_CASE("LineSource")
+{
+	const string puzzleInputFilePath = "aoc-test-line-source.txt";
+
+	SUBCASE("same lines as loadPuzzleInput")
+	{
+		const char* contents[] =
+		{
+			"",
+			"\n",
+			"abc",
+			"abc\ndef\n",
+			"abc\n\ndef\n\n",
+			"abc\r\ndef\r\n",
+			"a\nbcdefghijklmnopqrstuvwxyz\n0123456789\n\nxyz",
+		};
+
+		for(const char* content : contents)
+		{
+			{
+				ofstream fileStream(puzzleInputFilePath, ios::binary);
+
+				fileStream << content;
+			}
+
+			const vector<string> expectedLines = aoc::loadPuzzleInput(puzzleInputFilePath);
+
+			for(size_t bufferSize : { 1, 2, 3, 5, 8, 64 })
+			{
+				aoc::LineSource lineSource(puzzleInputFilePath, bufferSize);
+				aoc::ReadAheadLineSource readAheadLineSource(puzzleInputFilePath, bufferSize);
+
+				vector<string> lines;
+				vector<string> readAheadLines;
+				std::string_view line;
+
+				while(lineSource.nextLine(line))
+					lines.emplace_back(line);
+
+				while(readAheadLineSource.nextLine(line))
+					readAheadLines.emplace_back(line);
+
+				CHECK(lines == expectedLines);
+				CHECK(readAheadLines == expectedLines);
+				CHECK(!readAheadLineSource.nextLine(line));
+			}
+		}
+	}
+
+	SUBCASE("ReadAheadLineSource stopped early")
+	{
+		{
+			ofstream fileStream(puzzleInputFilePath, ios::binary);
+
+			for(size_t i=0; i<1000; ++i)
+				fileStream << i << '\n';
+		}
+
+		aoc::ReadAheadLineSource readAheadLineSource(puzzleInputFilePath, 16);
+		std::string_view line;
+
+		CHECK(readAheadLineSource.nextLine(line));
+		CHECK(line == "0");
+	}
+
+	remove(puzzleInputFilePath.c_str());
+}
+
+TEST_CASE("ParallelLineParser")
+{
+	vector<string> lines;
+	string buffer;
+
+	for(int i=0; i<1000; ++i)
+	{
+		lines.push_back(to_string(i * 7));
+		buffer += lines.back() + ((i % 2) ? "\r\n" : "\n");
+	}
+
+	auto parseLine = [](std::string_view line)
+	{
+		AOC_ENFORCE_MSG(!line.empty() && line.back() != '\r', "invalid line");
+
+		return stoi(string(line));
+	};
+
+	vector<int> expectedNumbers;
+
+	for(const auto& line : lines)
+		expectedNumbers.push_back(parseLine(line));
+
+	for(size_t numThreads : { 1, 2, 3, 8 })
+	{
+		aoc::ParallelLineParser<int> parallelLineParser(numThreads, 1, 1);
+
+		CHECK(parallelLineParser.parseLines(lines, parseLine) == expectedNumbers);
+		CHECK(parallelLineParser.parseBuffer(buffer, parseLine) == expectedNumbers);
+		CHECK(parallelLineParser.parseBuffer("", parseLine).empty());
+		CHECK(parallelLineParser.parseBuffer("1\n2", parseLine) == vector<int>({ 1, 2 }));
+
+		lines[500] = "";
+
+		CHECK_THROWS_WITH_AS(parallelLineParser.parseLines(lines, parseLine), "invalid line", runtime_error);
+
+		lines[500] = to_string(500 * 7);
+	}
+}
+
+TEST_CASE("findNewlines")
+{
+	string buffer;
+
+	for(size_t i=0; i<1000; ++i)
+		buffer += string(i % 37, 'a' + i % 26) + ((i % 3 == 0) ? "\r\n" : "\n");
+
+	vector<size_t> expectedNewlineOffsets;
+
+	for(size_t i=0; i<buffer.size(); ++i)
+		if(buffer[i] == '\n')
+			expectedNewlineOffsets.push_back(i);
+
+	for(size_t offset=0; offset<40; ++offset)
+	{
+		vector<size_t> newlineOffsets;
+
+		aoc::findNewlines(std::string_view(buffer).substr(offset), newlineOffsets);
+
+		vector<size_t> shiftedExpectedNewlineOffsets;
+
+		for(size_t newlineOffset : expectedNewlineOffsets)
+			if(newlineOffset >= offset)
+				shiftedExpectedNewlineOffsets.push_back(newlineOffset - offset);
+
+		CHECK(newlineOffsets == shiftedExpectedNewlineOffsets);
+	}
+}
+
+TEST_CASE("countBytes and findAnyByte")
+{
+	string buffer;
+
+	for(size_t i=0; i<1000; ++i)
+		buffer += static_cast<char>('a' + (i * 7) % 23);
+
+	const uint8_t vowels[] = { 'a', 'e', 'i', 'o', 'u' };
+
+	for(size_t offset=0; offset<40; ++offset)
+	{
+		const std::string_view str = std::string_view(buffer).substr(offset);
+
+		CHECK(aoc::countBytes(str.data(), str.size(), 'e') == static_cast<size_t>(std::count(str.begin(), str.end(), 'e')));
+		CHECK(aoc::countBytes(str.data(), str.size(), 'z') == 0);
+		CHECK(aoc::findAnyByte(str.data(), str.size(), vowels) == str.find_first_of("aeiou"));
+		CHECK(aoc::findAnyByte(str.data(), str.size(), span<const uint8_t>()) == str.size());
+	}
+
+	const string noMatches(100, 'x');
+
+	CHECK(aoc::findAnyByte(noMatches.data(), noMatches.size(), vowels) == noMatches.size());
+}
+
+TEST_CASE("BoundedGrid2D<char>")
+{
+	SUBCASE("smoke")
+	{
+		aoc::BoundedGrid2D<char> grid(7, 13, ' ');
+
+		CHECK(grid.width() == 7);
+		CHECK(grid.height() == 13);
+
+		for(size_t y=0; y<grid.height(); ++y)
+			for(size_t x=0; x<grid.width(); ++x)
+				CHECK(grid.cell(x, y) == ' ');
+	}
+
+	SUBCASE("setCells")
+	{
+		const vector<string> lines =
+		{
+			"..X...",
+			".SAMX.",
+			".A..A.",
+			"XMAS.S",
+			".X....",
+		};
+
+		aoc::BoundedGrid2D<char> grid(6, 5, ' ');
+
+		grid.setCells(lines);
+
+		const char* expectedGridStr = "..X...\n"
+		                              ".SAMX.\n"
+		                              ".A..A.\n"
+		                              "XMAS.S\n"
+		                              ".X....\n";
+
+		CHECK(grid.toString() == expectedGridStr);
+	}
+
+	SUBCASE("data")
+	{
+		aoc::BoundedGrid2D<char> grid(vector<string>({ "abc", "def" }));
+
+		CHECK(grid.rowStride() >= grid.width());
+		CHECK(reinterpret_cast<uintptr_t>(grid.data()) % aoc::BoundedGrid2D<char>::alignment == 0);
+
+		for(size_t y=0; y<grid.height(); ++y)
+			for(size_t x=0; x<grid.width(); ++x)
+				CHECK(&grid.cell(x, y) == grid.data() + y * grid.rowStride() + x);
+
+		CHECK(string(grid.data() + grid.rowStride(), 3) == "def");
+
+		grid.reset(5, 4, '#');
+
+		CHECK(grid.width() == 5);
+		CHECK(grid.height() == 4);
+		CHECK(grid.count('#') == 20);
+	}
+
+	SUBCASE("iterators")
+	{
+		static_assert(std::contiguous_iterator<decltype(declval<aoc::BoundedGrid2D<char>::ConstRow>().begin())>);
+		static_assert(std::random_access_iterator<aoc::StridedIterator<char>>);
+		static_assert(std::random_access_iterator<aoc::StridedIterator<const char>>);
+		static_assert(std::ranges::random_access_range<aoc::BoundedGrid2D<char>::ConstColumn>);
+		static_assert(std::ranges::random_access_range<aoc::BoundedGrid2D<char>::ConstReverseBottomUpDiagonal>);
+
+		aoc::BoundedGrid2D<char> grid(vector<string>({ "abcde", "fghij", "klmno" }));
+		const auto& constGrid = grid;
+
+		auto checkSequence = [](const auto& sequence)
+		{
+			CHECK(string(sequence.begin(), sequence.end()) == sequence.toString());
+			CHECK(static_cast<size_t>(sequence.end() - sequence.begin()) == sequence.length());
+
+			for(size_t i=0; i<sequence.length(); ++i)
+				CHECK(sequence.begin()[i] == sequence[i]);
+		};
+
+		for(size_t y=0; y<grid.height(); ++y)
+		{
+			checkSequence(grid.row(y));
+			checkSequence(constGrid.constRow(y));
+			checkSequence(grid.reverseRow(y));
+			checkSequence(constGrid.constReverseRow(y));
+		}
+
+		for(size_t x=0; x<grid.width(); ++x)
+		{
+			checkSequence(grid.column(x));
+			checkSequence(constGrid.constColumn(x));
+			checkSequence(grid.reverseColumn(x));
+			checkSequence(constGrid.constReverseColumn(x));
+		}
+
+		for(size_t i=0; i<grid.numDiagonals(); ++i)
+		{
+			checkSequence(grid.topDownDiagonal(i));
+			checkSequence(constGrid.constTopDownDiagonal(i));
+			checkSequence(grid.reverseTopDownDiagonal(i));
+			checkSequence(constGrid.constReverseTopDownDiagonal(i));
+			checkSequence(grid.bottomUpDiagonal(i));
+			checkSequence(constGrid.constBottomUpDiagonal(i));
+			checkSequence(grid.reverseBottomUpDiagonal(i));
+			checkSequence(constGrid.constReverseBottomUpDiagonal(i));
+		}
+
+		CHECK(constGrid.constRow(1).span().size() == 5);
+		CHECK(std::string_view(constGrid.constRow(1).begin(), constGrid.constRow(1).end()) == "fghij");
+
+		const std::string_view word = "hn";
+		const auto diagonal = constGrid.constTopDownDiagonal(3);
+
+		CHECK(std::search(diagonal.begin(), diagonal.end(), word.begin(), word.end()) - diagonal.begin() == 1);
+		CHECK(std::ranges::count(constGrid.constColumn(2), 'h') == 1);
+		CHECK(std::ranges::equal(constGrid.constReverseBottomUpDiagonal(4), std::string_view("eim")));
+
+		auto column = grid.column(0);
+		std::ranges::fill(column, '#');
+		std::ranges::reverse(grid.row(2));
+
+		CHECK(grid.toString() == "#bcde\n#ghij\nonml#\n");
+	}
+
+	SUBCASE("numDiagonals")
+	{
+		CHECK(aoc::BoundedGrid2D<int>(0, 0).numDiagonals() == 0);
+		CHECK(aoc::BoundedGrid2D<int>(1, 1).numDiagonals() == 1);
+		CHECK(aoc::BoundedGrid2D<int>(10, 0).numDiagonals() == 0);
+		CHECK(aoc::BoundedGrid2D<int>(0, 10).numDiagonals() == 0);
+		CHECK(aoc::BoundedGrid2D<int>(10, 1).numDiagonals() == 10);
+		CHECK(aoc::BoundedGrid2D<int>(1, 10).numDiagonals() == 10);
+		CHECK(aoc::BoundedGrid2D<int>(10, 5).numDiagonals() == 14);
+		CHECK(aoc::BoundedGrid2D<int>(5, 10).numDiagonals() == 14);
+		CHECK(aoc::BoundedGrid2D<int>(10, 10).numDiagonals() == 19);
+		CHECK(aoc::BoundedGrid2D<int>(3, 4).numDiagonals() == 6);
+		CHECK(aoc::BoundedGrid2D<int>(4, 3).numDiagonals() == 6);
+	}
+
+	SUBCASE("maxDiagonalLength")
+	{
+		CHECK(aoc::BoundedGrid2D<int>(0, 0).maxDiagonalLength() == 0);
+		CHECK(aoc::BoundedGrid2D<int>(1, 1).maxDiagonalLength() == 1);
+		CHECK(aoc::BoundedGrid2D<int>(10, 0).maxDiagonalLength() == 0);
+		CHECK(aoc::BoundedGrid2D<int>(0, 10).maxDiagonalLength() == 0);
+		CHECK(aoc::BoundedGrid2D<int>(10, 1).maxDiagonalLength() == 1);
+		CHECK(aoc::BoundedGrid2D<int>(1, 10).maxDiagonalLength() == 1);
+		CHECK(aoc::BoundedGrid2D<int>(10, 5).maxDiagonalLength() == 5);
+		CHECK(aoc::BoundedGrid2D<int>(5, 10).maxDiagonalLength() == 5);
+		CHECK(aoc::BoundedGrid2D<int>(10, 10).maxDiagonalLength() == 10);
+		CHECK(aoc::BoundedGrid2D<int>(3, 4).maxDiagonalLength() == 3);
+		CHECK(aoc::BoundedGrid2D<int>(4, 3).maxDiagonalLength() == 3);
+	}
+
+	SUBCASE("diagonalLength")
+	{
+		//    345
+		// 2 ....
+		// 1 ....
+		// 0 ....
+		//
+		// 0 ....
+		// 1 ....
+		// 2 ....
+		//    345
+		aoc::BoundedGrid2D<char> grid4x3(4, 3, '.');
+
+		CHECK(grid4x3.diagonalLength(0) == 1);
+		CHECK(grid4x3.diagonalLength(1) == 2);
+		CHECK(grid4x3.diagonalLength(2) == 3);
+		CHECK(grid4x3.diagonalLength(3) == 3);
+		CHECK(grid4x3.diagonalLength(4) == 2);
+		CHECK(grid4x3.diagonalLength(5) == 1);
+
+		//    45
+		// 3 ...
+		// 2 ...
+		// 1 ...
+		// 0 ...
+		//
+		// 0 ...
+		// 1 ...
+		// 2 ...
+		// 3 ...
+		//    45
+		aoc::BoundedGrid2D<char> grid3x4(3, 4, '.');
+
+		CHECK(grid3x4.diagonalLength(0) == 1);
+		CHECK(grid3x4.diagonalLength(1) == 2);
+		CHECK(grid3x4.diagonalLength(2) == 3);
+		CHECK(grid3x4.diagonalLength(3) == 3);
+		CHECK(grid3x4.diagonalLength(4) == 2);
+		CHECK(grid3x4.diagonalLength(5) == 1);
+
+		//    1234
+		// 0 .....
+		//
+		// 0 .....
+		//    1234
+		aoc::BoundedGrid2D<char> grid5x1(5, 1, '.');
+
+		CHECK(grid5x1.diagonalLength(0) == 1);
+		CHECK(grid5x1.diagonalLength(1) == 1);
+		CHECK(grid5x1.diagonalLength(2) == 1);
+		CHECK(grid5x1.diagonalLength(3) == 1);
+		CHECK(grid5x1.diagonalLength(4) == 1);
+
+		// 4 .
+		// 3 .
+		// 2 .
+		// 1 .
+		// 0 .
+		//
+		// 0 .
+		// 1 .
+		// 2 .
+		// 3 .
+		// 4 .
+		aoc::BoundedGrid2D<char> grid1x5(1, 5, '.');
+
+		CHECK(grid1x5.diagonalLength(0) == 1);
+		CHECK(grid1x5.diagonalLength(1) == 1);
+		CHECK(grid1x5.diagonalLength(2) == 1);
+		CHECK(grid1x5.diagonalLength(3) == 1);
+		CHECK(grid1x5.diagonalLength(4) == 1);
+	}
+
+	SUBCASE("count")
+	{
+		aoc::BoundedGrid2D<char> grid(37, 11, '.');
+
+		for(size_t y=0; y<grid.height(); ++y)
+			for(size_t x=0; x<grid.width(); x+=y+1)
+				grid.setCell(x, y, '#');
+
+		size_t expectedCount = 0;
+
+		for(size_t y=0; y<grid.height(); ++y)
+			expectedCount += (grid.width() + y) / (y + 1);
+
+		CHECK(grid.count('#') == expectedCount);
+		CHECK(grid.count('.') == grid.numCells() - expectedCount);
+		CHECK(grid.count('@') == 0);
+
+		aoc::BoundedGrid2D<int> intGrid(5, 4, 7);
+
+		intGrid.setCell(4, 3, 9);
+
+		CHECK(intGrid.count(7) == 19);
+		CHECK(intGrid.count(9) == 1);
+	}
+
+	SUBCASE("findAnyCell")
+	{
+		aoc::BoundedGrid2D<char> grid(50, 20, '.');
+
+		CHECK(grid.findAnyCell({ '^', '>', 'v', '<' }) == aoc::Point2uz(aoc::BoundedGrid2D<char>::npos, aoc::BoundedGrid2D<char>::npos));
+
+		grid.setCell(49, 19, '<');
+
+		CHECK(grid.findAnyCell({ '^', '>', 'v', '<' }) == aoc::Point2uz(49, 19));
+
+		grid.setCell(3, 17, 'v');
+
+		CHECK(grid.findAnyCell({ '^', '>', 'v', '<' }) == aoc::Point2uz(3, 17));
+		CHECK(grid.findAnyCell({ '^', '<' }) == aoc::Point2uz(49, 19));
+		CHECK(grid.findCell('v') == aoc::Point2uz(3, 17));
+
+		aoc::BoundedGrid2D<int> intGrid(5, 4, 7);
+
+		intGrid.setCell(2, 1, 9);
+
+		CHECK(intGrid.findAnyCell({ 8, 9 }) == aoc::Point2uz(2, 1));
+		CHECK(intGrid.findCell(8) == aoc::Point2uz(aoc::BoundedGrid2D<int>::npos, aoc::BoundedGrid2D<int>::npos));
+	}
+
+	SUBCASE("findCell")
+	{
+		const vector<string> lines =
+		{
+			"....#.....",
+			".........#",
+			"..........",
+			"..#.......",
+			".......#..",
+			"..........",
+			".#..^.....",
+			"........#.",
+			"#.........",
+			"......#...",
+		};
+
+		aoc::BoundedGrid2D<char> grid(lines);
+
+		CHECK(grid.findCell('^') == aoc::Point2uz(4, 6));
+	}
+
+	SUBCASE("toString")
+	{
+		aoc::BoundedGrid2D<char> grid(4, 3, '.');
+
+		grid.setCell(1, 0, '*');
+		grid.setCell(2, 1, '@');
+		grid.setCell(0, 2, '#');
+		grid.setCell(3, 2, '!');
+
+		const char* expectedGridStr = ".*..\n"
+		                              "..@.\n"
+		                              "#..!\n";
+
+		CHECK(grid.toString() == expectedGridStr);
+	}
+
+	SUBCASE("row")
+	{
+		const vector<string> lines =
+		{
+			"00000000000000",
+			"11111111111111",
+			"22222222222222",
+		};
+
+		aoc::BoundedGrid2D<char> grid(lines);
+
+		CHECK(grid.row(0).toString() == "00000000000000");
+		CHECK(grid.row(1).toString() == "11111111111111");
+		CHECK(grid.row(2).toString() == "22222222222222");
+
+		aoc::BoundedGrid2D<char>::Row row1 = grid.row(1);
+
+		for(size_t i=0; i<row1.length(); ++i)
+			CHECK(row1[i] == '1');
+
+		CHECK(grid.constRow(0).toString() == "00000000000000");
+		CHECK(grid.constRow(1).toString() == "11111111111111");
+		CHECK(grid.constRow(2).toString() == "22222222222222");
+
+		aoc::BoundedGrid2D<char>::ConstRow constRow1 = grid.constRow(1);
+
+		for(size_t i=0; i<constRow1.length(); ++i)
+			CHECK(constRow1[i] == '1');
+	}
+
+	SUBCASE("reverseRow")
+	{
+		const vector<string> lines =
+		{
+			"abcdefghijklm",
+			"nopqrstuvwxyz",
+		};
+
+		aoc::BoundedGrid2D<char> grid(lines);
+
+		CHECK(grid.reverseRow(0).toString() == "mlkjihgfedcba");
+		CHECK(grid.reverseRow(1).toString() == "zyxwvutsrqpon");
+
+		aoc::BoundedGrid2D<char>::ReverseRow reverseRow0 = grid.reverseRow(0);
+
+		for(size_t i=0; i<reverseRow0.length(); ++i)
+			CHECK(reverseRow0[i] == lines[0][13-i-1]);
+
+		CHECK(grid.constReverseRow(0).toString() == "mlkjihgfedcba");
+		CHECK(grid.constReverseRow(1).toString() == "zyxwvutsrqpon");
+
+		aoc::BoundedGrid2D<char>::ConstReverseRow constReverseRow0 = grid.constReverseRow(0);
+
+		for(size_t i=0; i<constReverseRow0.length(); ++i)
+			CHECK(constReverseRow0[i] == lines[0][13-i-1]);
+	}
+
+	SUBCASE("column")
+	{
+		const vector<string> lines =
+		{
+			"0ak",
+			"1bl",
+			"2cm",
+			"3dn",
+			"4eo",
+			"5fp",
+			"6gq",
+			"7hr",
+			"8is",
+			"9jt",
+		};
+
+		aoc::BoundedGrid2D<char> grid(lines);
+
+		CHECK(grid.column(0).toString() == "0123456789");
+		CHECK(grid.column(1).toString() == "abcdefghij");
+		CHECK(grid.column(2).toString() == "klmnopqrst");
+
+		aoc::BoundedGrid2D<char>::Column column1 = grid.column(1);
+
+		for(size_t i=0; i<column1.length(); ++i)
+			CHECK(column1[i] == 'a' + i);
+
+		CHECK(grid.constColumn(0).toString() == "0123456789");
+		CHECK(grid.constColumn(1).toString() == "abcdefghij");
+		CHECK(grid.constColumn(2).toString() == "klmnopqrst");
+
+		aoc::BoundedGrid2D<char>::ConstColumn constColumn1 = grid.constColumn(1);
+
+		for(size_t i=0; i<constColumn1.length(); ++i)
+			CHECK(constColumn1[i] == 'a' + i);
+	}
+
+	SUBCASE("reverseColumn")
+	{
+		const vector<string> lines =
+		{
+			"an",
+			"bo",
+			"cp",
+			"dq",
+			"er",
+			"fs",
+			"gt",
+			"hu",
+			"iv",
+			"jw",
+			"kx",
+			"ly",
+			"mz",
+		};
+
+		aoc::BoundedGrid2D<char> grid(lines);
+
+		CHECK(grid.reverseColumn(0).toString() == "mlkjihgfedcba");
+		CHECK(grid.reverseColumn(1).toString() == "zyxwvutsrqpon");
+
+		aoc::BoundedGrid2D<char>::ReverseColumn reverseColumn0 = grid.reverseColumn(0);
+
+		for(size_t i=0; i<reverseColumn0.length(); ++i)
+			CHECK(reverseColumn0[i] == lines[13-i-1][0]);
+
+		CHECK(grid.constReverseColumn(0).toString() == "mlkjihgfedcba");
+		CHECK(grid.constReverseColumn(1).toString() == "zyxwvutsrqpon");
+
+		aoc::BoundedGrid2D<char>::ConstReverseColumn constReverseColumn0 = grid.constReverseColumn(0);
+
+		for(size_t i=0; i<constReverseColumn0.length(); ++i)
+			CHECK(constReverseColumn0[i] == lines[13-i-1][0]);
+	}
+
+	SUBCASE("topDownDiagonal")
+	{
+		const vector<string> lines1 =
+		{
+			"abcde",
+			"fghij",
+			"klmno",
+		};
+
+		aoc::BoundedGrid2D<char> grid(lines1);
+
+		CHECK(grid.topDownDiagonal(0).toString() == "k");
+		CHECK(grid.topDownDiagonal(1).toString() == "fl");
+		CHECK(grid.topDownDiagonal(2).toString() == "agm");
+		CHECK(grid.topDownDiagonal(3).toString() == "bhn");
+		CHECK(grid.topDownDiagonal(4).toString() == "cio");
+		CHECK(grid.topDownDiagonal(5).toString() == "dj");
+		CHECK(grid.topDownDiagonal(6).toString() == "e");
+
+		const vector<string> lines2 =
+		{
+			"abcd",
+			"efgh",
+			"ijkl",
+			"mnop",
+		};
+
+		grid.reset(lines2);
+
+		CHECK(grid.topDownDiagonal(0).toString() == "m");
+		CHECK(grid.topDownDiagonal(1).toString() == "in");
+		CHECK(grid.topDownDiagonal(2).toString() == "ejo");
+		CHECK(grid.topDownDiagonal(3).toString() == "afkp");
+		CHECK(grid.topDownDiagonal(4).toString() == "bgl");
+		CHECK(grid.topDownDiagonal(5).toString() == "ch");
+		CHECK(grid.topDownDiagonal(6).toString() == "d");
+
+		const vector<string> lines3 =
+		{
+			"abcd",
+		};
+
+		grid.reset(lines3);
+
+		CHECK(grid.topDownDiagonal(0).toString() == "a");
+		CHECK(grid.topDownDiagonal(1).toString() == "b");
+		CHECK(grid.topDownDiagonal(2).toString() == "c");
+		CHECK(grid.topDownDiagonal(3).toString() == "d");
+
+		const vector<string> lines4 =
+		{
+			"abcdefgh",
+		};
+
+		grid.reset(lines4);
+
+		CHECK(grid.topDownDiagonal(0).toString() == "a");
+		CHECK(grid.topDownDiagonal(1).toString() == "b");
+		CHECK(grid.topDownDiagonal(2).toString() == "c");
+		CHECK(grid.topDownDiagonal(3).toString() == "d");
+		CHECK(grid.topDownDiagonal(4).toString() == "e");
+		CHECK(grid.topDownDiagonal(5).toString() == "f");
+		CHECK(grid.topDownDiagonal(6).toString() == "g");
+		CHECK(grid.topDownDiagonal(7).toString() == "h");
+	}
+
+	SUBCASE("constTopDownDiagonal")
+	{
+		const vector<string> lines1 =
+		{
+			"abcde",
+			"fghij",
+			"klmno",
+		};
+
+		aoc::BoundedGrid2D<char> grid(lines1);
+
+		CHECK(grid.constTopDownDiagonal(0).toString() == "k");
+		CHECK(grid.constTopDownDiagonal(1).toString() == "fl");
+		CHECK(grid.constTopDownDiagonal(2).toString() == "agm");
+		CHECK(grid.constTopDownDiagonal(3).toString() == "bhn");
+		CHECK(grid.constTopDownDiagonal(4).toString() == "cio");
+		CHECK(grid.constTopDownDiagonal(5).toString() == "dj");
+		CHECK(grid.constTopDownDiagonal(6).toString() == "e");
+
+		const vector<string> lines2 =
+		{
+			"abcd",
+			"efgh",
+			"ijkl",
+			"mnop",
+		};
+
+		grid.reset(lines2);
+
+		CHECK(grid.constTopDownDiagonal(0).toString() == "m");
+		CHECK(grid.constTopDownDiagonal(1).toString() == "in");
+		CHECK(grid.constTopDownDiagonal(2).toString() == "ejo");
+		CHECK(grid.constTopDownDiagonal(3).toString() == "afkp");
+		CHECK(grid.constTopDownDiagonal(4).toString() == "bgl");
+		CHECK(grid.constTopDownDiagonal(5).toString() == "ch");
+		CHECK(grid.constTopDownDiagonal(6).toString() == "d");
+
+		const vector<string> lines3 =
+		{
+			"abcd",
+		};
+
+		grid.reset(lines3);
+
+		CHECK(grid.constTopDownDiagonal(0).toString() == "a");
+		CHECK(grid.constTopDownDiagonal(1).toString() == "b");
+		CHECK(grid.constTopDownDiagonal(2).toString() == "c");
+		CHECK(grid.constTopDownDiagonal(3).toString() == "d");
+
+		const vector<string> lines4 =
+		{
+			"abcdefgh",
+		};
+
+		grid.reset(lines4);
+
+		CHECK(grid.constTopDownDiagonal(0).toString() == "a");
+		CHECK(grid.constTopDownDiagonal(1).toString() == "b");
+		CHECK(grid.constTopDownDiagonal(2).toString() == "c");
+		CHECK(grid.constTopDownDiagonal(3).toString() == "d");
+		CHECK(grid.constTopDownDiagonal(4).toString() == "e");
+		CHECK(grid.constTopDownDiagonal(5).toString() == "f");
+		CHECK(grid.constTopDownDiagonal(6).toString() == "g");
+		CHECK(grid.constTopDownDiagonal(7).toString() == "h");
+	}
+
+	SUBCASE("reverseTopDownDiagonal")
+	{
+		const vector<string> lines1 =
+		{
+			"abcde",
+			"fghij",
+			"klmno",
+		};
+
+		aoc::BoundedGrid2D<char> grid(lines1);
+
+		CHECK(grid.reverseTopDownDiagonal(0).toString() == "k");
+		CHECK(grid.reverseTopDownDiagonal(1).toString() == "lf");
+		CHECK(grid.reverseTopDownDiagonal(2).toString() == "mga");
+		CHECK(grid.reverseTopDownDiagonal(3).toString() == "nhb");
+		CHECK(grid.reverseTopDownDiagonal(4).toString() == "oic");
+		CHECK(grid.reverseTopDownDiagonal(5).toString() == "jd");
+		CHECK(grid.reverseTopDownDiagonal(6).toString() == "e");
+
+		const vector<string> lines2 =
+		{
+			"abcd",
+			"efgh",
+			"ijkl",
+			"mnop",
+		};
+
+		grid.reset(lines2);
+
+		CHECK(grid.reverseTopDownDiagonal(0).toString() == "m");
+		CHECK(grid.reverseTopDownDiagonal(1).toString() == "ni");
+		CHECK(grid.reverseTopDownDiagonal(2).toString() == "oje");
+		CHECK(grid.reverseTopDownDiagonal(3).toString() == "pkfa");
+		CHECK(grid.reverseTopDownDiagonal(4).toString() == "lgb");
+		CHECK(grid.reverseTopDownDiagonal(5).toString() == "hc");
+		CHECK(grid.reverseTopDownDiagonal(6).toString() == "d");
+
+		const vector<string> lines3 =
+		{
+			"abcd",
+		};
+
+		grid.reset(lines3);
+
+		CHECK(grid.reverseTopDownDiagonal(0).toString() == "a");
+		CHECK(grid.reverseTopDownDiagonal(1).toString() == "b");
+		CHECK(grid.reverseTopDownDiagonal(2).toString() == "c");
+		CHECK(grid.reverseTopDownDiagonal(3).toString() == "d");
+
+		const vector<string> lines4 =
+		{
+			"abcdefgh",
+		};
+
+		grid.reset(lines4);
+
+		CHECK(grid.reverseTopDownDiagonal(0).toString() == "a");
+		CHECK(grid.reverseTopDownDiagonal(1).toString() == "b");
+		CHECK(grid.reverseTopDownDiagonal(2).toString() == "c");
+		CHECK(grid.reverseTopDownDiagonal(3).toString() == "d");
+		CHECK(grid.reverseTopDownDiagonal(4).toString() == "e");
+		CHECK(grid.reverseTopDownDiagonal(5).toString() == "f");
+		CHECK(grid.reverseTopDownDiagonal(6).toString() == "g");
+		CHECK(grid.reverseTopDownDiagonal(7).toString() == "h");
+	}
+
+	SUBCASE("constReverseTopDownDiagonal")
+	{
+		const vector<string> lines1 =
+		{
+			"abcde",
+			"fghij",
+			"klmno",
+		};
+
+		aoc::BoundedGrid2D<char> grid(lines1);
+
+		CHECK(grid.constReverseTopDownDiagonal(0).toString() == "k");
+		CHECK(grid.constReverseTopDownDiagonal(1).toString() == "lf");
+		CHECK(grid.constReverseTopDownDiagonal(2).toString() == "mga");
+		CHECK(grid.constReverseTopDownDiagonal(3).toString() == "nhb");
+		CHECK(grid.constReverseTopDownDiagonal(4).toString() == "oic");
+		CHECK(grid.constReverseTopDownDiagonal(5).toString() == "jd");
+		CHECK(grid.constReverseTopDownDiagonal(6).toString() == "e");
+
+		const vector<string> lines2 =
+		{
+			"abcd",
+			"efgh",
+			"ijkl",
+			"mnop",
+		};
+
+		grid.reset(lines2);
+
+		CHECK(grid.constReverseTopDownDiagonal(0).toString() == "m");
+		CHECK(grid.constReverseTopDownDiagonal(1).toString() == "ni");
+		CHECK(grid.constReverseTopDownDiagonal(2).toString() == "oje");
+		CHECK(grid.constReverseTopDownDiagonal(3).toString() == "pkfa");
+		CHECK(grid.constReverseTopDownDiagonal(4).toString() == "lgb");
+		CHECK(grid.constReverseTopDownDiagonal(5).toString() == "hc");
+		CHECK(grid.constReverseTopDownDiagonal(6).toString() == "d");
+
+		const vector<string> lines3 =
+		{
+			"abcd",
+		};
+
+		grid.reset(lines3);
+
+		CHECK(grid.constReverseTopDownDiagonal(0).toString() == "a");
+		CHECK(grid.constReverseTopDownDiagonal(1).toString() == "b");
+		CHECK(grid.constReverseTopDownDiagonal(2).toString() == "c");
+		CHECK(grid.constReverseTopDownDiagonal(3).toString() == "d");
+
+		const vector<string> lines4 =
+		{
+			"abcdefgh",
+		};
+
+		grid.reset(lines4);
+
+		CHECK(grid.constReverseTopDownDiagonal(0).toString() == "a");
+		CHECK(grid.constReverseTopDownDiagonal(1).toString() == "b");
+		CHECK(grid.constReverseTopDownDiagonal(2).toString() == "c");
+		CHECK(grid.constReverseTopDownDiagonal(3).toString() == "d");
+		CHECK(grid.constReverseTopDownDiagonal(4).toString() == "e");
+		CHECK(grid.constReverseTopDownDiagonal(5).toString() == "f");
+		CHECK(grid.constReverseTopDownDiagonal(6).toString() == "g");
+		CHECK(grid.constReverseTopDownDiagonal(7).toString() == "h");
+	}
+
+	SUBCASE("bottomUpDiagonal")
+	{
+		const vector<string> lines1 =
+		{
+			"abcde",
+			"fghij",
+			"klmno",
+		};
+
+		aoc::BoundedGrid2D<char> grid(lines1);
+
+		CHECK(grid.bottomUpDiagonal(0).toString() == "a");
+		CHECK(grid.bottomUpDiagonal(1).toString() == "fb");
+		CHECK(grid.bottomUpDiagonal(2).toString() == "kgc");
+		CHECK(grid.bottomUpDiagonal(3).toString() == "lhd");
+		CHECK(grid.bottomUpDiagonal(4).toString() == "mie");
+		CHECK(grid.bottomUpDiagonal(5).toString() == "nj");
+		CHECK(grid.bottomUpDiagonal(6).toString() == "o");
+
+		const vector<string> lines2 =
+		{
+			"abcd",
+			"efgh",
+			"ijkl",
+			"mnop",
+		};
+
+		grid.reset(lines2);
+
+		CHECK(grid.bottomUpDiagonal(0).toString() == "a");
+		CHECK(grid.bottomUpDiagonal(1).toString() == "eb");
+		CHECK(grid.bottomUpDiagonal(2).toString() == "ifc");
+		CHECK(grid.bottomUpDiagonal(3).toString() == "mjgd");
+		CHECK(grid.bottomUpDiagonal(4).toString() == "nkh");
+		CHECK(grid.bottomUpDiagonal(5).toString() == "ol");
+		CHECK(grid.bottomUpDiagonal(6).toString() == "p");
+
+		const vector<string> lines3 =
+		{
+			"abcd",
+		};
+
+		grid.reset(lines3);
+
+		CHECK(grid.bottomUpDiagonal(0).toString() == "a");
+		CHECK(grid.bottomUpDiagonal(1).toString() == "b");
+		CHECK(grid.bottomUpDiagonal(2).toString() == "c");
+		CHECK(grid.bottomUpDiagonal(3).toString() == "d");
+
+		const vector<string> lines4 =
+		{
+			"abcdefgh",
+		};
+
+		grid.reset(lines4);
+
+		CHECK(grid.bottomUpDiagonal(0).toString() == "a");
+		CHECK(grid.bottomUpDiagonal(1).toString() == "b");
+		CHECK(grid.bottomUpDiagonal(2).toString() == "c");
+		CHECK(grid.bottomUpDiagonal(3).toString() == "d");
+		CHECK(grid.bottomUpDiagonal(4).toString() == "e");
+		CHECK(grid.bottomUpDiagonal(5).toString() == "f");
+		CHECK(grid.bottomUpDiagonal(6).toString() == "g");
+		CHECK(grid.bottomUpDiagonal(7).toString() == "h");
+	}
+
+	SUBCASE("constBottomUpDiagonal")
+	{
+		const vector<string> lines1 =
+		{
+			"abcde",
+			"fghij",
+			"klmno",
+		};
+
+		aoc::BoundedGrid2D<char> grid(lines1);
+
+		CHECK(grid.constBottomUpDiagonal(0).toString() == "a");
+		CHECK(grid.constBottomUpDiagonal(1).toString() == "fb");
+		CHECK(grid.constBottomUpDiagonal(2).toString() == "kgc");
+		CHECK(grid.constBottomUpDiagonal(3).toString() == "lhd");
+		CHECK(grid.constBottomUpDiagonal(4).toString() == "mie");
+		CHECK(grid.constBottomUpDiagonal(5).toString() == "nj");
+		CHECK(grid.constBottomUpDiagonal(6).toString() == "o");
+
+		const vector<string> lines2 =
+		{
+			"abcd",
+			"efgh",
+			"ijkl",
+			"mnop",
+		};
+
+		grid.reset(lines2);
+
+		CHECK(grid.constBottomUpDiagonal(0).toString() == "a");
+		CHECK(grid.constBottomUpDiagonal(1).toString() == "eb");
+		CHECK(grid.constBottomUpDiagonal(2).toString() == "ifc");
+		CHECK(grid.constBottomUpDiagonal(3).toString() == "mjgd");
+		CHECK(grid.constBottomUpDiagonal(4).toString() == "nkh");
+		CHECK(grid.constBottomUpDiagonal(5).toString() == "ol");
+		CHECK(grid.constBottomUpDiagonal(6).toString() == "p");
+
+		const vector<string> lines3 =
+		{
+			"abcd",
+		};
+
+		grid.reset(lines3);
+
+		CHECK(grid.constBottomUpDiagonal(0).toString() == "a");
+		CHECK(grid.constBottomUpDiagonal(1).toString() == "b");
+		CHECK(grid.constBottomUpDiagonal(2).toString() == "c");
+		CHECK(grid.constBottomUpDiagonal(3).toString() == "d");
+
+		const vector<string> lines4 =
+		{
+			"abcdefgh",
+		};
+
+		grid.reset(lines4);
+
+		CHECK(grid.constBottomUpDiagonal(0).toString() == "a");
+		CHECK(grid.constBottomUpDiagonal(1).toString() == "b");
+		CHECK(grid.constBottomUpDiagonal(2).toString() == "c");
+		CHECK(grid.constBottomUpDiagonal(3).toString() == "d");
+		CHECK(grid.constBottomUpDiagonal(4).toString() == "e");
+		CHECK(grid.constBottomUpDiagonal(5).toString() == "f");
+		CHECK(grid.constBottomUpDiagonal(6).toString() == "g");
+		CHECK(grid.constBottomUpDiagonal(7).toString() == "h");
+	}
+
+	SUBCASE("reverseBottomUpDiagonal")
+	{
+		const vector<string> lines1 =
+		{
+			"abcde",
+			"fghij",
+			"klmno",
+		};
+
+		aoc::BoundedGrid2D<char> grid(lines1);
+
+		CHECK(grid.reverseBottomUpDiagonal(0).toString() == "a");
+		CHECK(grid.reverseBottomUpDiagonal(1).toString() == "bf");
+		CHECK(grid.reverseBottomUpDiagonal(2).toString() == "cgk");
+		CHECK(grid.reverseBottomUpDiagonal(3).toString() == "dhl");
+		CHECK(grid.reverseBottomUpDiagonal(4).toString() == "eim");
+		CHECK(grid.reverseBottomUpDiagonal(5).toString() == "jn");
+		CHECK(grid.reverseBottomUpDiagonal(6).toString() == "o");
+
+		const vector<string> lines2 =
+		{
+			"abcd",
+			"efgh",
+			"ijkl",
+			"mnop",
+		};
+
+		grid.reset(lines2);
+
+		CHECK(grid.reverseBottomUpDiagonal(0).toString() == "a");
+		CHECK(grid.reverseBottomUpDiagonal(1).toString() == "be");
+		CHECK(grid.reverseBottomUpDiagonal(2).toString() == "cfi");
+		CHECK(grid.reverseBottomUpDiagonal(3).toString() == "dgjm");
+		CHECK(grid.reverseBottomUpDiagonal(4).toString() == "hkn");
+		CHECK(grid.reverseBottomUpDiagonal(5).toString() == "lo");
+		CHECK(grid.reverseBottomUpDiagonal(6).toString() == "p");
+
+		const vector<string> lines3 =
+		{
+			"abcd",
+		};
+
+		grid.reset(lines3);
+
+		CHECK(grid.reverseBottomUpDiagonal(0).toString() == "a");
+		CHECK(grid.reverseBottomUpDiagonal(1).toString() == "b");
+		CHECK(grid.reverseBottomUpDiagonal(2).toString() == "c");
+		CHECK(grid.reverseBottomUpDiagonal(3).toString() == "d");
+
+		const vector<string> lines4 =
+		{
+			"abcdefgh",
+		};
+
+		grid.reset(lines4);
+
+		CHECK(grid.reverseBottomUpDiagonal(0).toString() == "a");
+		CHECK(grid.reverseBottomUpDiagonal(1).toString() == "b");
+		CHECK(grid.reverseBottomUpDiagonal(2).toString() == "c");
+		CHECK(grid.reverseBottomUpDiagonal(3).toString() == "d");
+		CHECK(grid.reverseBottomUpDiagonal(4).toString() == "e");
+		CHECK(grid.reverseBottomUpDiagonal(5).toString() == "f");
+		CHECK(grid.reverseBottomUpDiagonal(6).toString() == "g");
+		CHECK(grid.reverseBottomUpDiagonal(7).toString() == "h");
+	}
+
+	SUBCASE("constReverseBottomUpDiagonal")
+	{
+		const vector<string> lines1 =
+		{
+			"abcde",
+			"fghij",
+			"klmno",
+		};
+
+		aoc::BoundedGrid2D<char> grid(lines1);
+
+		CHECK(grid.constReverseBottomUpDiagonal(0).toString() == "a");
+		CHECK(grid.constReverseBottomUpDiagonal(1).toString() == "bf");
+		CHECK(grid.constReverseBottomUpDiagonal(2).toString() == "cgk");
+		CHECK(grid.constReverseBottomUpDiagonal(3).toString() == "dhl");
+		CHECK(grid.constReverseBottomUpDiagonal(4).toString() == "eim");
+		CHECK(grid.constReverseBottomUpDiagonal(5).toString() == "jn");
+		CHECK(grid.constReverseBottomUpDiagonal(6).toString() == "o");
+
+		const vector<string> lines2 =
+		{
+			"abcd",
+			"efgh",
+			"ijkl",
+			"mnop",
+		};
+
+		grid.reset(lines2);
+
+		CHECK(grid.constReverseBottomUpDiagonal(0).toString() == "a");
+		CHECK(grid.constReverseBottomUpDiagonal(1).toString() == "be");
+		CHECK(grid.constReverseBottomUpDiagonal(2).toString() == "cfi");
+		CHECK(grid.constReverseBottomUpDiagonal(3).toString() == "dgjm");
+		CHECK(grid.constReverseBottomUpDiagonal(4).toString() == "hkn");
+		CHECK(grid.constReverseBottomUpDiagonal(5).toString() == "lo");
+		CHECK(grid.constReverseBottomUpDiagonal(6).toString() == "p");
+
+		const vector<string> lines3 =
+		{
+			"abcd",
+		};
+
+		grid.reset(lines3);
+
+		CHECK(grid.constReverseBottomUpDiagonal(0).toString() == "a");
+		CHECK(grid.constReverseBottomUpDiagonal(1).toString() == "b");
+		CHECK(grid.constReverseBottomUpDiagonal(2).toString() == "c");
+		CHECK(grid.constReverseBottomUpDiagonal(3).toString() == "d");
+
+		const vector<string> lines4 =
+		{
+			"abcdefgh",
+		};
+
+		grid.reset(lines4);
+
+		CHECK(grid.constReverseBottomUpDiagonal(0).toString() == "a");
+		CHECK(grid.constReverseBottomUpDiagonal(1).toString() == "b");
+		CHECK(grid.constReverseBottomUpDiagonal(2).toString() == "c");
+		CHECK(grid.constReverseBottomUpDiagonal(3).toString() == "d");
+		CHECK(grid.constReverseBottomUpDiagonal(4).toString() == "e");
+		CHECK(grid.constReverseBottomUpDiagonal(5).toString() == "f");
+		CHECK(grid.constReverseBottomUpDiagonal(6).toString() == "g");
+		CHECK(grid.constReverseBottomUpDiagonal(7).toString() == "h");
+	}
+
+	SUBCASE("adjacentNeighbors")
+	{
+		const vector<string> lines1 =
+		{
+			"abcde",
+			"fghij",
+			"klmno",
+		};
+
+		aoc::BoundedGrid2D<char> grid(lines1);
+
+		CHECK(grid.adjacentNeighbors(0, 0).toString() == "bf");
+		CHECK(grid.adjacentNeighbors(0, 1).toString() == "agk");
+		CHECK(grid.adjacentNeighbors(0, 2).toString() == "fl");
+
+		CHECK(grid.adjacentNeighbors(2, 0).toString() == "bdh");
+		CHECK(grid.adjacentNeighbors(2, 1).toString() == "cgim");
+		CHECK(grid.adjacentNeighbors(2, 2).toString() == "hln");
+
+		CHECK(grid.adjacentNeighbors(4, 0).toString() == "dj");
+		CHECK(grid.adjacentNeighbors(4, 1).toString() == "eio");
+		CHECK(grid.adjacentNeighbors(4, 2).toString() == "jn");
+	}
+}
+
+TEST_CASE("BoundedGrid2D layouts")
+{
+	SUBCASE("index")
+	{
+		const aoc::TiledLayout<4> tiledLayout(10, 6);
+
+		CHECK(tiledLayout.size() == 3 * 2 * 16);
+		CHECK(tiledLayout.index(0, 0) == 0);
+		CHECK(tiledLayout.index(3, 0) == 3);
+		CHECK(tiledLayout.index(0, 1) == 4);
+		CHECK(tiledLayout.index(4, 0) == 16);
+		CHECK(tiledLayout.index(9, 5) == 5 * 16 + 1 * 4 + 1);
+
+		const aoc::MortonLayout mortonLayout(4, 4);
+
+		CHECK(mortonLayout.size() == 16);
+		CHECK(mortonLayout.index(0, 0) == 0);
+		CHECK(mortonLayout.index(1, 0) == 1);
+		CHECK(mortonLayout.index(0, 1) == 2);
+		CHECK(mortonLayout.index(1, 1) == 3);
+		CHECK(mortonLayout.index(2, 0) == 4);
+		CHECK(mortonLayout.index(3, 3) == 15);
+		CHECK(aoc::MortonLayout(3, 5).size() == mortonLayout.index(2, 4) + 1);
+	}
+
+	vector<string> lines;
+
+	for(size_t y=0; y<11; ++y)
+	{
+		lines.emplace_back();
+
+		for(size_t x=0; x<37; ++x)
+			lines.back() += "XMAS."[((x * 7919) ^ (y * 104729) ^ (x * y)) % 5];
+	}
+
+	const aoc::BoundedGrid2D<char> rowMajorGrid(lines);
+
+	auto checkLayout = [&]<class Layout>()
+	{
+		aoc::BoundedGrid2D<char, Layout> grid(lines);
+
+		CHECK(grid.width() == rowMajorGrid.width());
+		CHECK(grid.height() == rowMajorGrid.height());
+		CHECK(grid.toString() == rowMajorGrid.toString());
+
+		for(size_t y=0; y<grid.height(); ++y)
+			for(size_t x=0; x<grid.width(); ++x)
+				CHECK(grid.cell(x, y) == rowMajorGrid.cell(x, y));
+
+		for(char ch : string("XMAS.#"))
+		{
+			CHECK(grid.count(ch) == rowMajorGrid.count(ch));
+			CHECK(grid.findCell(ch) == rowMajorGrid.findCell(ch));
+		}
+
+		CHECK(grid.findAnyCell({ 'A', 'S' }) == rowMajorGrid.findAnyCell({ 'A', 'S' }));
+
+		for(size_t x=0; x<grid.width(); ++x)
+			CHECK(grid.constColumn(x).toString() == rowMajorGrid.constColumn(x).toString());
+
+		for(size_t i=0; i<grid.numDiagonals(); ++i)
+		{
+			CHECK(grid.constTopDownDiagonal(i).toString() == rowMajorGrid.constTopDownDiagonal(i).toString());
+			CHECK(grid.constBottomUpDiagonal(i).toString() == rowMajorGrid.constBottomUpDiagonal(i).toString());
+		}
+
+		grid.setCell(36, 10, '#');
+
+		CHECK(grid.findCell('#') == aoc::Point2uz(36, 10));
+		CHECK(grid.count('#') == 1);
+
+		grid.reset(5, 3, '#');
+
+		CHECK(grid.count('#') == 15);
+		CHECK(grid.toString() == "#####\n#####\n#####\n");
+	};
+
+	SUBCASE("TiledLayout<8>") { checkLayout.operator()<aoc::TiledLayout<8>>(); }
+	SUBCASE("TiledLayout<16>") { checkLayout.operator()<aoc::TiledLayout<16>>(); }
+	SUBCASE("MortonLayout") { checkLayout.operator()<aoc::MortonLayout>(); }
+}
+
+TEST_CASE("GridWordSearch")
+{
+	using aoc::CompassDirection;
+	using aoc::GridWordSearch;
+
+	SUBCASE("example")
+	{
+		const vector<string> lines =
+		{
+			"MMMSXXMASM",
+			"MSAMXMSMSA",
+			"AMXSXMAAMM",
+			"MSAMASMSMX",
+			"XMASAMXAMM",
+			"XXAMMXXAMA",
+			"SMSMSASXSS",
+			"SAXAMASAAA",
+			"MAMMMXMMMM",
+			"MXMXAXMASX",
+		};
+
+		const aoc::BoundedGrid2D<char> grid(lines);
+
+		CHECK(GridWordSearch::countWord(grid, "XMAS") == 18);
+		CHECK(GridWordSearch::countWord(grid, "XMAS", GridWordSearch::directionMask(CompassDirection::East)) == 3);
+		CHECK(GridWordSearch::countWord(grid, "XMAS", GridWordSearch::directionMask(CompassDirection::West)) == 2);
+		CHECK(GridWordSearch::countWord(grid, "XMAS", GridWordSearch::directionMask(CompassDirection::North) |
+		                                              GridWordSearch::directionMask(CompassDirection::South)) == 3);
+		CHECK(GridWordSearch::countWord(grid, "XMAS", 0) == 0);
+		CHECK(GridWordSearch::countWord(grid, "XMASXMASXMAS") == 0);
+		CHECK(GridWordSearch::countWord(grid, "X") == 19 * 8);
+	}
+
+	SUBCASE("matches brute force")
+	{
+		auto countWordBruteForce = [](const aoc::BoundedGrid2D<char>& grid, const string& word, uint8_t directions)
+		{
+			size_t count = 0;
+
+			for(size_t d=0; d<8; ++d)
+			{
+				if(!(directions & GridWordSearch::directionMask(static_cast<CompassDirection>(d))))
+					continue;
+
+				const aoc::Point2i delta = aoc::compassDeltaPositionFor[d];
+
+				for(int y=0; y<static_cast<int>(grid.height()); ++y)
+				{
+					for(int x=0; x<static_cast<int>(grid.width()); ++x)
+					{
+						size_t i = 0;
+
+						for(; i<word.size(); ++i)
+						{
+							const int cx = x + static_cast<int>(i) * delta.x_;
+							const int cy = y + static_cast<int>(i) * delta.y_;
+
+							if(cx < 0 || cx >= static_cast<int>(grid.width()) ||
+							   cy < 0 || cy >= static_cast<int>(grid.height()) ||
+							   grid.cell(cx, cy) != word[i])
+								break;
+						}
+
+						if(i == word.size())
+							++count;
+					}
+				}
+			}
+
+			return count;
+		};
+
+		const char* words[] = { "A", "AB", "ABA", "ABC", "ABCA", "BBBBB" };
+
+		for(size_t width : { 1, 2, 3, 5, 17, 40, 71 })
+		{
+			for(size_t height : { 1, 3, 4, 9, 33 })
+			{
+				aoc::BoundedGrid2D<char> grid(width, height);
+
+				for(size_t y=0; y<height; ++y)
+					for(size_t x=0; x<width; ++x)
+						grid.setCell(x, y, "ABC"[((x * 7919) ^ (y * 104729) ^ (x * y)) % 3]);
+
+				for(const char* word : words)
+				{
+					for(unsigned directions : { 0x01u, 0x06u, 0x30u, 0x81u, 0x5au, 0xffu })
+					{
+						CHECK(GridWordSearch::countWord(grid, word, static_cast<uint8_t>(directions)) ==
+						      countWordBruteForce(grid, word, static_cast<uint8_t>(directions)));
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST_CASE("GridPattern")
+{
+	using aoc::GridPattern;
+
+	const vector<string> lines =
+	{
+		"MMMSXXMASM",
+		"MSAMXMSMSA",
+		"AMXSXMAAMM",
+		"MSAMASMSMX",
+		"XMASAMXAMM",
+		"XXAMMXXAMA",
+		"SMSMSASXSS",
+		"SAXAMASAAA",
+		"MAMMMXMMMM",
+		"MXMXAXMASX",
+	};
+
+	const aoc::BoundedGrid2D<char> grid(lines);
+
+	SUBCASE("variants")
+	{
+		CHECK(GridPattern({ "M.S", ".A.", "M.S" }).numVariants() == 1);
+		CHECK(GridPattern({ "M.S", ".A.", "M.S" }, '.', GridPattern::rotations).numVariants() == 4);
+		CHECK(GridPattern({ "M.S", ".A.", "M.S" }, '.', GridPattern::rotations | GridPattern::reflections).numVariants() == 4);
+		CHECK(GridPattern({ "XM" }, '.', GridPattern::rotations).numVariants() == 4);
+		CHECK(GridPattern({ "XM" }, '.', GridPattern::reflections).numVariants() == 2);
+		CHECK(GridPattern({ "XX", "XX" }, '.', GridPattern::rotations | GridPattern::reflections).numVariants() == 1);
+		CHECK(GridPattern({ "XM.", "..A" }, '.', GridPattern::rotations | GridPattern::reflections).numVariants() == 8);
+	}
+
+	SUBCASE("count")
+	{
+		CHECK(GridPattern({ "M.S", ".A.", "M.S" }, '.', GridPattern::rotations).count(grid) == 9);
+		CHECK(GridPattern({ "XMAS" }).count(grid) == 3);
+		CHECK(GridPattern({ "XMAS" }, '.', GridPattern::rotations | GridPattern::reflections).count(grid) == 8);
+		CHECK(GridPattern({ "..." }).count(grid) == 8 * 10);
+		CHECK(GridPattern({ "XMASXMASXMAS" }).count(grid) == 0);
+		CHECK(GridPattern({ "M", "M", "M", "M", "M", "M", "M", "M", "M", "M", "M" }).count(grid) == 0);
+	}
+
+	SUBCASE("matches brute force")
+	{
+		const vector<string> patterns[] =
+		{
+			{ "A" },
+			{ "AB" },
+			{ "A.C" },
+			{ "AB", "CA" },
+			{ "A.B", ".C.", "B.A" },
+			{ "ABCA", "..B." },
+		};
+
+		for(size_t width : { 1, 3, 16, 35, 70 })
+		{
+			for(size_t height : { 1, 2, 5, 19 })
+			{
+				aoc::BoundedGrid2D<char> randomGrid(width, height);
+
+				for(size_t y=0; y<height; ++y)
+					for(size_t x=0; x<width; ++x)
+						randomGrid.setCell(x, y, "ABC"[((x * 7919) ^ (y * 104729) ^ (x * y)) % 3]);
+
+				for(const auto& pattern : patterns)
+				{
+					const GridPattern gridPattern(pattern, '.', GridPattern::rotations | GridPattern::reflections);
+
+					size_t expectedCount = 0;
+
+					// All eight rotations and reflections, deduplicated.
+					set<vector<string>> variants;
+					vector<string> variant = pattern;
+
+					for(size_t r=0; r<4; ++r)
+					{
+						vector<string> rotated(variant[0].size(), string(variant.size(), ' '));
+
+						for(size_t y=0; y<rotated.size(); ++y)
+							for(size_t x=0; x<variant.size(); ++x)
+								rotated[y][x] = variant[variant.size() - 1 - x][y];
+
+						variant = rotated;
+						variants.insert(variant);
+
+						for(auto& row : variant)
+							std::reverse(row.begin(), row.end());
+
+						variants.insert(variant);
+
+						for(auto& row : variant)
+							std::reverse(row.begin(), row.end());
+					}
+
+					for(const auto& v : variants)
+					{
+						for(size_t y=0; y+v.size()<=height; ++y)
+						{
+							for(size_t x=0; x+v[0].size()<=width; ++x)
+							{
+								bool isMatch = true;
+
+								for(size_t py=0; py<v.size(); ++py)
+									for(size_t px=0; px<v[0].size(); ++px)
+										isMatch = isMatch && (v[py][px] == '.' || v[py][px] == randomGrid.cell(x + px, y + py));
+
+								if(isMatch)
+									++expectedCount;
+							}
+						}
+					}
+
+					CHECK(gridPattern.numVariants() == variants.size());
+					CHECK(gridPattern.count(randomGrid) == expectedCount);
+				}
+			}
+		}
+	}
+}
+
+TEST_CASE("BitGrid")
+{
+	using aoc::BitGrid;
+
+	SUBCASE("smoke")
+	{
+		BitGrid grid(70, 3);
+
+		CHECK(grid.width() == 70);
+		CHECK(grid.height() == 3);
+		CHECK(grid.rowStride() == 2);
+		CHECK(grid.count() == 0);
+		CHECK(grid.count(false) == 210);
+		CHECK(grid.findCell() == aoc::Point2uz(BitGrid::npos, BitGrid::npos));
+		CHECK(grid.findCell(false) == aoc::Point2uz(0, 0));
+
+		grid.setCell(69, 1, true);
+		grid.setCell(aoc::Point2uz(3, 2), true);
+		grid.setCell(aoc::Point2i(64, 0), true);
+
+		CHECK(grid.cell(69, 1));
+		CHECK(grid.cell(aoc::Point2i(3, 2)));
+		CHECK(!grid.cell(68, 1));
+		CHECK(grid.count() == 3);
+		CHECK(grid.findCell() == aoc::Point2uz(64, 0));
+
+		grid.setCell(64, 0, false);
+
+		CHECK(grid.findCell() == aoc::Point2uz(69, 1));
+
+		CHECK(!grid.testAndSetCell(0, 0));
+		CHECK( grid.testAndSetCell(0, 0));
+		CHECK(grid.count() == 3);
+
+		grid.clear();
+
+		CHECK(grid.count() == 0);
+	}
+
+	SUBCASE("full rows keep padding clear")
+	{
+		BitGrid grid(70, 3, true);
+
+		CHECK(grid.count() == 210);
+		CHECK(grid.count(false) == 0);
+		CHECK(grid.findCell(false) == aoc::Point2uz(BitGrid::npos, BitGrid::npos));
+
+		grid ^= BitGrid(70, 3, true);
+
+		CHECK(grid.count() == 0);
+		CHECK(grid == BitGrid(70, 3));
+	}
+
+	SUBCASE("from BoundedGrid2D")
+	{
+		const vector<string> lines =
+		{
+			"....#.....",
+			".........#",
+			"..........",
+			"..#.......",
+			".......#..",
+			"..........",
+			".#..^.....",
+			"........#.",
+			"#.........",
+			"......#...",
+		};
+
+		const aoc::BoundedGrid2D<char> map(lines);
+		const BitGrid obstacles(map, '#');
+
+		CHECK(obstacles.count() == map.count('#'));
+		CHECK(obstacles.findCell() == map.findCell('#'));
+		CHECK(obstacles.toString('#', '.') == aoc::StringUtils::replaceAll(map.toString(), "^", "."));
+		CHECK(BitGrid(map, '^').findCell() == aoc::Point2uz(4, 6));
+	}
+
+	SUBCASE("findFirstSetInRow")
+	{
+		BitGrid grid(200, 2);
+
+		for(size_t x : { 5, 63, 64, 130, 199 })
+			grid.setCell(x, 1, true);
+
+		CHECK(grid.findFirstSetInRow(0) == BitGrid::npos);
+		CHECK(grid.findFirstSetInRow(1) == 5);
+		CHECK(grid.findFirstSetInRow(1, 5) == 5);
+		CHECK(grid.findFirstSetInRow(1, 6) == 63);
+		CHECK(grid.findFirstSetInRow(1, 64) == 64);
+		CHECK(grid.findFirstSetInRow(1, 65) == 130);
+		CHECK(grid.findFirstSetInRow(1, 131) == 199);
+		CHECK(grid.findFirstSetInRow(1, 200) == BitGrid::npos);
+
+		size_t numSetCells = 0;
+
+		for(size_t x=grid.findFirstSetInRow(1); x!=BitGrid::npos; x=grid.findFirstSetInRow(1, x + 1))
+			++numSetCells;
+
+		CHECK(numSetCells == 5);
+	}
+
+	SUBCASE("set operations")
+	{
+		BitGrid a(100, 4);
+		BitGrid b(100, 4);
+
+		for(size_t y=0; y<4; ++y)
+		{
+			for(size_t x=0; x<100; ++x)
+			{
+				a.setCell(x, y, x % 2 == 0);
+				b.setCell(x, y, x % 3 == 0);
+			}
+		}
+
+		CHECK((a & b).count() == 4 * 17);
+		CHECK((a | b).count() == 4 * (50 + 34 - 17));
+		CHECK((a ^ b).count() == 4 * (50 + 34 - 2 * 17));
+
+		for(size_t y=0; y<4; ++y)
+			for(size_t x=0; x<100; ++x)
+				CHECK((a ^ b).cell(x, y) == ((x % 2 == 0) != (x % 3 == 0)));
+	}
+}
+
+TEST_CASE("PaddedGrid2D")
+{
+	const vector<string> lines =
+	{
+		"0123",
+		"1234",
+		"8765",
+	};
+
+	const aoc::BoundedGrid2D<char> grid(lines);
+
+	SUBCASE("layout")
+	{
+		aoc::PaddedGrid2D<char> paddedGrid(grid, 2, '#');
+
+		CHECK(paddedGrid.width() == 4);
+		CHECK(paddedGrid.height() == 3);
+		CHECK(paddedGrid.padding() == 2);
+		CHECK(paddedGrid.sentinel() == '#');
+		CHECK(paddedGrid.rowStride() == 8);
+		CHECK(paddedGrid.size() == 8 * 7);
+		CHECK(paddedGrid.toString() == grid.toString());
+
+		CHECK(std::string_view(paddedGrid.data(), paddedGrid.size()) == "########"
+		                                                                "########"
+		                                                                "##0123##"
+		                                                                "##1234##"
+		                                                                "##8765##"
+		                                                                "########"
+		                                                                "########");
+
+		CHECK(paddedGrid.index(0, 0) == 18);
+		CHECK(paddedGrid.position(paddedGrid.index(3, 2)) == aoc::Point2uz(3, 2));
+
+		paddedGrid.setCell(1, 1, '*');
+
+		CHECK(paddedGrid.cell(1, 1) == '*');
+		CHECK(paddedGrid[paddedGrid.index(1, 1)] == '*');
+	}
+
+	SUBCASE("offsets")
+	{
+		const aoc::PaddedGrid2D<char> paddedGrid(grid, 1, '#');
+
+		const size_t corner = paddedGrid.index(0, 0);
+
+		CHECK(paddedGrid[corner + paddedGrid.offset(aoc::Direction::North)] == '#');
+		CHECK(paddedGrid[corner + paddedGrid.offset(aoc::Direction::West)] == '#');
+		CHECK(paddedGrid[corner + paddedGrid.offset(aoc::Direction::East)] == '1');
+		CHECK(paddedGrid[corner + paddedGrid.offset(aoc::Direction::South)] == '1');
+		CHECK(paddedGrid[corner + paddedGrid.offset(1, 1)] == '2');
+		CHECK(paddedGrid[corner + paddedGrid.offset(-1, -1)] == '#');
+
+		const size_t center = paddedGrid.index(2, 1);
+
+		string neighbors;
+
+		for(ptrdiff_t offset : paddedGrid.adjacentOffsets())
+			neighbors += paddedGrid[center + offset];
+
+		CHECK(neighbors == "2462");
+	}
+
+	SUBCASE("init")
+	{
+		const aoc::PaddedGrid2D<int> paddedGrid(3, 2, 1, -1, 7);
+
+		size_t numInteriorCells = 0;
+		size_t numBorderCells = 0;
+
+		for(size_t i=0; i<paddedGrid.size(); ++i)
+		{
+			numInteriorCells += (paddedGrid[i] == 7);
+			numBorderCells += (paddedGrid[i] == -1);
+		}
+
+		CHECK(numInteriorCells == 6);
+		CHECK(numBorderCells == 5 * 4 - 6);
+	}
+}
+
+TEST_CASE("OverlayGrid2D")
+{
+	const vector<string> lines =
+	{
+		"....#.....",
+		".........#",
+		"..........",
+		"..#.......",
+		".......#..",
+	};
+
+	const aoc::BoundedGrid2D<char> base(lines);
+
+	aoc::OverlayGrid2D<char> grid(base);
+
+	CHECK(grid.width() == 10);
+	CHECK(grid.height() == 5);
+	CHECK(grid.toString() == base.toString());
+	CHECK(grid.numModifiedCells() == 0);
+
+	grid.setCell(0, 0, 'X');
+	grid.setCell(aoc::Point2uz(0, 0), 'Y');
+	grid.setCell(aoc::Point2i(9, 4), '#');
+	grid.setCell(4, 0, '#');
+
+	CHECK(grid.cell(0, 0) == 'Y');
+	CHECK(grid.cell(aoc::Point2i(9, 4)) == '#');
+	CHECK(grid.numModifiedCells() == 3);
+	CHECK(grid.count('#') == 5);
+	CHECK(grid.findCell('Y') == aoc::Point2uz(0, 0));
+	CHECK(grid.findAnyCell({ 'Y', '#' }) == aoc::Point2uz(0, 0));
+	CHECK(base.cell(0, 0) == '.');
+
+	grid.setCell(0, 0, '.');
+	grid.setCell(0, 0, 'Z');
+
+	CHECK(grid.numModifiedCells() == 3);
+
+	grid.reset();
+
+	CHECK(grid.numModifiedCells() == 0);
+	CHECK(grid.toString() == base.toString());
+	CHECK(grid.grid().toString() == base.toString());
+}
+
+TEST_CASE("UnboundedGrid2D")
+{
+	SUBCASE("cells")
+	{
+		aoc::UnboundedGrid2D<char, 8> grid('.');
+
+		const aoc::UnboundedGrid2D<char, 8>& constGrid = grid;
+
+		CHECK(constGrid.cell(0, 0) == '.');
+		CHECK(constGrid.cell(-1000, 1000) == '.');
+		CHECK(grid.numChunks() == 0);
+
+		grid.setCell(0, 0, 'a');
+		grid.setCell(-1, -1, 'b');
+		grid.setCell(aoc::Point2i(7, 8), 'c');
+		grid.setCell(-8, -9, 'd');
+		grid.cell(1000000, -1000000) = 'e';
+
+		CHECK(constGrid.cell(0, 0) == 'a');
+		CHECK(constGrid.cell(-1, -1) == 'b');
+		CHECK(constGrid.cell(aoc::Point2i(7, 8)) == 'c');
+		CHECK(constGrid.cell(-8, -9) == 'd');
+		CHECK(constGrid.cell(1000000, -1000000) == 'e');
+		CHECK(constGrid.cell(1, 0) == '.');
+		CHECK(constGrid.cell(-2, -1) == '.');
+		CHECK(constGrid.cell(-9, -1) == '.');
+		CHECK(grid.numChunks() == 5);
+		CHECK(grid.numAllocatedCells() == 5 * 64);
+
+		grid.clear();
+
+		CHECK(grid.numChunks() == 0);
+		CHECK(constGrid.cell(0, 0) == '.');
+	}
+
+	SUBCASE("testAndSetCell")
+	{
+		aoc::UnboundedGrid2D<bool> visited;
+
+		set<pair<int, int>> expectedVisited;
+
+		int x = 0;
+		int y = 0;
+
+		for(int i=0; i<20000; ++i)
+		{
+			x += (i * 7919) % 5 - 2;
+			y += (i * 104729) % 3 - 1;
+
+			CHECK(visited.testAndSetCell(x, y) == !expectedVisited.insert({ x, y }).second);
+		}
+
+		for(const auto& [vx, vy] : expectedVisited)
+			CHECK(visited.cell(aoc::Point2i(vx, vy)));
+	}
+}
+
+TEST_CASE("GridTraversal")
+{
+	const aoc::BoundedGrid2D<char> grid(vector<string>
+	{
+		"....",
+		".##.",
+		"...#",
+		"#...",
+	});
+
+	aoc::GridTraversal traversal(grid.width(), grid.height());
+
+	auto isOpen = [&](const aoc::Point2uz& pos) { return grid.cell(pos) == '.'; };
+	auto canStep = [&](const aoc::Point2uz&, const aoc::Point2uz& to) { return isOpen(to); };
+
+	CHECK(!traversal.isVisited(aoc::Point2uz(0, 0)));
+	CHECK(!traversal.isVisited(aoc::Point2uz(3, 3)));
+
+	SUBCASE("breadthFirst")
+	{
+		aoc::BoundedGrid2D<int> distance(grid.width(), grid.height(), -1);
+
+		distance.setCell(0, 0, 0);
+
+		auto canStepAndMeasure = [&](const aoc::Point2uz& from, const aoc::Point2uz& to)
+		{
+			if(!isOpen(to))
+				return false;
+
+			if(!traversal.isVisited(to))
+				distance.cell(to) = distance.cell(from) + 1;
+
+			return true;
+		};
+
+		int lastDistance = 0;
+		bool isInDistanceOrder = true;
+
+		auto visit = [&](const aoc::Point2uz& pos)
+		{
+			isInDistanceOrder = isInDistanceOrder && distance.cell(pos) >= lastDistance;
+			lastDistance = distance.cell(pos);
+		};
+
+		CHECK(traversal.breadthFirst(aoc::Point2uz(0, 0), canStepAndMeasure, visit) == 12);
+		CHECK(isInDistanceOrder);
+		CHECK(distance.cell(3, 3) == 6);
+		CHECK(distance.cell(3, 1) == 4);
+		CHECK(distance.cell(1, 1) == -1);
+		CHECK( traversal.isVisited(aoc::Point2uz(2, 2)));
+		CHECK(!traversal.isVisited(aoc::Point2uz(3, 2)));
+
+		const vector<aoc::Point2uz> starts = { aoc::Point2uz(3, 0), aoc::Point2uz(0, 2) };
+
+		vector<aoc::Point2uz> visited;
+
+		CHECK(traversal.breadthFirst(starts, canStep, [&](const aoc::Point2uz& pos) { visited.push_back(pos); }) == 12);
+		CHECK(visited[0] == starts[0]);
+		CHECK(visited[1] == starts[1]);
+	}
+
+	SUBCASE("depthFirst")
+	{
+		CHECK(traversal.depthFirst(aoc::Point2uz(3, 3), canStep, [](const aoc::Point2uz&) {}) == 12);
+		CHECK( traversal.isVisited(aoc::Point2uz(0, 0)));
+		CHECK(!traversal.isVisited(aoc::Point2uz(0, 3)));
+	}
+
+	SUBCASE("floodFill")
+	{
+		string filled = grid.toString();
+
+		auto visit = [&](const aoc::Point2uz& pos) { filled[pos.y_ * (grid.width() + 1) + pos.x_] = 'o'; };
+
+		CHECK(traversal.floodFill(aoc::Point2uz(1, 1), [&](const aoc::Point2uz& pos) { return grid.cell(pos) == '#'; }, visit) == 2);
+		CHECK(filled == "....\n.oo.\n...#\n#...\n");
+
+		// Reusing the traversal must not allocate or clear anything, even when
+		// the epoch wraps around.
+		size_t numVisited = 0;
+
+		for(int i=0; i<70000; ++i)
+			numVisited += traversal.floodFill(aoc::Point2uz(i % 4, 0), isOpen, [](const aoc::Point2uz&) {});
+
+		CHECK(numVisited == 70000 * 12);
+	}
+
+	SUBCASE("connectedComponents")
+	{
+		aoc::BoundedGrid2D<size_t> components(grid.width(), grid.height());
+
+		auto isSameRegion = [&](const aoc::Point2uz& from, const aoc::Point2uz& to) { return grid.cell(from) == grid.cell(to); };
+
+		CHECK(traversal.connectedComponents(isSameRegion, [&](const aoc::Point2uz& pos, size_t component) { components.cell(pos) = component; }) == 4);
+		CHECK(components.cell(0, 0) == components.cell(3, 3));
+		CHECK(components.cell(1, 1) == components.cell(2, 1));
+		CHECK(components.cell(1, 1) != components.cell(3, 2));
+		CHECK(components.cell(3, 2) != components.cell(0, 3));
+		CHECK(components.cell(0, 0) != components.cell(0, 3));
+	}
+
+	SUBCASE("large grid")
+	{
+		constexpr size_t size = 1000;
+
+		traversal.reset(size, size);
+
+		// A serpentine corridor, which would need a recursion depth of about
+		// half a million cells.
+		auto isCorridor = [&](const aoc::Point2uz& pos)
+		{
+			return pos.y_ % 2 == 0 || pos.x_ == ((pos.y_ % 4 == 1) ? size - 1 : 0);
+		};
+
+		auto canStepInCorridor = [&](const aoc::Point2uz&, const aoc::Point2uz& to) { return isCorridor(to); };
+
+		const size_t numCorridorCells = (size / 2) * size + size / 2;
+
+		CHECK(traversal.depthFirst(aoc::Point2uz(0, 0), canStepInCorridor, [](const aoc::Point2uz&) {}) == numCorridorCells);
+		CHECK(traversal.breadthFirst(aoc::Point2uz(0, 0), canStepInCorridor, [](const aoc::Point2uz&) {}) == numCorridorCells);
+	}
+}
+
+TEST_CASE("BucketQueue")
+{
+	aoc::BucketQueue<char> queue(3);
+
+	CHECK(queue.empty());
+
+	queue.push(0, 'a');
+	queue.push(3, 'd');
+	queue.push(2, 'c');
+
+	CHECK(queue.size() == 3);
+	CHECK(queue.pop() == 'a');
+	CHECK(queue.priority() == 0);
+
+	queue.push(1, 'b');
+
+	CHECK(queue.pop() == 'b');
+	CHECK(queue.pop() == 'c');
+
+	queue.push(5, 'f');
+	queue.push(4, 'e');
+
+	CHECK(queue.pop() == 'd');
+	CHECK(queue.pop() == 'e');
+	CHECK(queue.pop() == 'f');
+	CHECK(queue.priority() == 5);
+	CHECK(queue.empty());
+
+	queue.reset(1, 100);
+	queue.push(101, 'x');
+
+	CHECK(queue.pop() == 'x');
+	CHECK(queue.priority() == 101);
+}
+
+TEST_CASE("GridPathFinder")
+{
+	typedef aoc::GridPathFinder::Cost Cost;
+
+	SUBCASE("weighted")
+	{
+		// The cost of a step is the digit of the cell stepped onto.
+		aoc::BoundedGrid2D<char> grid(12, 9);
+
+		uint64_t state = 0x9e3779b97f4a7c15;
+
+		for(size_t i=0; i<grid.numCells(); ++i)
+		{
+			state ^= state << 13;
+			state ^= state >> 7;
+			state ^= state << 17;
+
+			grid.data()[i] = (state % 5 == 0) ? '#' : static_cast<char>('1' + state % 9);
+		}
+
+		grid.setCell(0, 0, '1');
+
+		auto stepCost = [&](const aoc::Point2uz&, const aoc::Point2uz& to) -> Cost
+		{
+			return (grid.cell(to) == '#') ? aoc::GridPathFinder::noStep : grid.cell(to) - '0';
+		};
+
+		// Bellman-Ford relaxation as reference.
+		aoc::BoundedGrid2D<Cost> expected(grid.width(), grid.height(), aoc::GridPathFinder::unreachable);
+
+		expected.setCell(0, 0, 0);
+
+		for(bool isRelaxed=true; isRelaxed; )
+		{
+			isRelaxed = false;
+
+			for(size_t y=0; y<grid.height(); ++y)
+			{
+				for(size_t x=0; x<grid.width(); ++x)
+				{
+					if(expected.cell(x, y) == aoc::GridPathFinder::unreachable)
+						continue;
+
+					for(aoc::Direction direction : { aoc::Direction::North, aoc::Direction::East, aoc::Direction::South, aoc::Direction::West })
+					{
+						const aoc::Point2i to = aoc::nextPosition(aoc::Point2i(x, y), direction);
+
+						if(to.x_ < 0 || to.y_ < 0 || size_t(to.x_) >= grid.width() || size_t(to.y_) >= grid.height())
+							continue;
+
+						const Cost cost = stepCost(aoc::Point2uz(x, y), aoc::Point2uz(to));
+
+						if(cost != aoc::GridPathFinder::noStep && expected.cell(x, y) + cost < expected.cell(aoc::Point2uz(to)))
+						{
+							expected.cell(aoc::Point2uz(to)) = expected.cell(x, y) + cost;
+							isRelaxed = true;
+						}
+					}
+				}
+			}
+		}
+
+		aoc::GridPathFinder pathFinder(grid.width(), grid.height(), 9);
+
+		pathFinder.dijkstra(aoc::Point2uz(0, 0), stepCost);
+
+		bool isEqual = true;
+
+		for(size_t y=0; y<grid.height(); ++y)
+			for(size_t x=0; x<grid.width(); ++x)
+				isEqual = isEqual && pathFinder.distance(aoc::Point2uz(x, y)) == expected.cell(x, y);
+
+		CHECK(isEqual);
+
+		for(size_t y=0; y<grid.height(); ++y)
+		{
+			for(size_t x=0; x<grid.width(); ++x)
+			{
+				const aoc::Point2uz goal(x, y);
+
+				isEqual = isEqual && pathFinder.dijkstra(aoc::Point2uz(0, 0), goal, stepCost) == expected.cell(goal);
+				isEqual = isEqual && pathFinder.aStar(aoc::Point2uz(0, 0), goal, stepCost) == expected.cell(goal);
+			}
+		}
+
+		CHECK(isEqual);
+	}
+
+	SUBCASE("directed")
+	{
+		auto lowestScore = [](const vector<string>& lines)
+		{
+			const aoc::BoundedGrid2D<char> maze(lines);
+
+			auto stepCost = [&](const aoc::Point2uz&, const aoc::Point2uz& to) -> Cost
+			{
+				return (maze.cell(to) == '#') ? aoc::GridPathFinder::noStep : 1;
+			};
+
+			aoc::GridPathFinder pathFinder(maze.width(), maze.height(), 1, true, 1000);
+
+			const aoc::GridPathFinder::Start start(maze.findCell('S'), aoc::Direction::East);
+			const aoc::Point2uz goal = maze.findCell('E');
+
+			const Cost score = pathFinder.dijkstra(start, goal, stepCost);
+
+			CHECK(pathFinder.aStar(start, goal, stepCost) == score);
+
+			pathFinder.dijkstra(start, stepCost);
+
+			CHECK(pathFinder.distance(goal) == score);
+
+			return score;
+		};
+
+		CHECK(lowestScore(
+		{
+			"###############",
+			"#.......#....E#",
+			"#.#.###.#.###.#",
+			"#.....#.#...#.#",
+			"#.###.#####.#.#",
+			"#.#.#.......#.#",
+			"#.#.#####.###.#",
+			"#...........#.#",
+			"###.#.#####.#.#",
+			"#...#.....#.#.#",
+			"#.#.#.###.#.#.#",
+			"#.....#...#.#.#",
+			"#.###.#.#.#.#.#",
+			"#S..#.....#...#",
+			"###############",
+		}) == 7036);
+
+		CHECK(lowestScore(
+		{
+			"#################",
+			"#...#...#...#..E#",
+			"#.#.#.#.#.#.#.#.#",
+			"#.#.#.#...#...#.#",
+			"#.#.#.#.###.#.#.#",
+			"#...#.#.#.....#.#",
+			"#.#.#.#.#.#####.#",
+			"#.#...#.#.#.....#",
+			"#.#.#####.#.###.#",
+			"#.#.#.......#...#",
+			"#.#.###.#####.###",
+			"#.#.#...#.....#.#",
+			"#.#.#.#####.###.#",
+			"#.#.#.........#.#",
+			"#.#.#.#########.#",
+			"#S#.............#",
+			"#################",
+		}) == 11048);
+
+		const aoc::BoundedGrid2D<char> walls(vector<string> { "..", "#." });
+
+		aoc::GridPathFinder pathFinder(2, 2, 1, true, 10);
+
+		CHECK(pathFinder.dijkstra({ aoc::Point2uz(0, 0), aoc::Direction::North }, aoc::Point2uz(0, 1), [&](const aoc::Point2uz&, const aoc::Point2uz& to)
+		{
+			return (walls.cell(to) == '#') ? aoc::GridPathFinder::noStep : Cost(1);
+		}) == aoc::GridPathFinder::unreachable);
+
+		CHECK(pathFinder.distance(aoc::Point2uz(1, 1), aoc::Direction::South) == 22);
+	}
+}
+
+TEST_CASE("CellularAutomaton")
+{
+	const aoc::CellularAutomaton::LifeLikeRule conway;
+
+	auto conwayRule = [](const aoc::CellularAutomaton::Neighborhood& neighborhood)
+	{
+		const size_t numAlive = neighborhood.count('#');
+
+		return (numAlive == 3 || (numAlive == 2 && neighborhood.cell() == '#')) ? '#' : '.';
+	};
+
+	const aoc::BoundedGrid2D<char> lights(vector<string>
+	{
+		".#.#.#",
+		"...##.",
+		"#....#",
+		"..#...",
+		"#.#..#",
+		"####..",
+	});
+
+	SUBCASE("lights")
+	{
+		aoc::CellularAutomaton automaton(lights);
+
+		automaton.step(conwayRule);
+
+		CHECK(automaton.generation() == 1);
+		CHECK(automaton.toString() == "..##..\n..##.#\n...##.\n......\n#.....\n#.##..\n");
+
+		automaton.step(conwayRule, 3);
+
+		CHECK(automaton.generation() == 4);
+		CHECK(automaton.count('#') == 4);
+
+		automaton.reset(lights);
+		automaton.step(conway, 4);
+
+		CHECK(automaton.count('#') == 4);
+		CHECK(automaton.grid().toString() == "......\n......\n..##..\n..##..\n......\n......\n");
+
+		// The corners are stuck on.
+		auto turnCornersOn = [&]()
+		{
+			automaton.setCell(0, 0, '#');
+			automaton.setCell(5, 0, '#');
+			automaton.setCell(0, 5, '#');
+			automaton.setCell(5, 5, '#');
+		};
+
+		automaton.reset(lights);
+		turnCornersOn();
+
+		for(int i=0; i<5; ++i)
+		{
+			automaton.step(conway);
+			turnCornersOn();
+		}
+
+		CHECK(automaton.count('#') == 17);
+	}
+
+	SUBCASE("bands and SIMD")
+	{
+		aoc::BoundedGrid2D<char> grid(77, 40, '.');
+
+		uint64_t state = 0x9e3779b97f4a7c15;
+
+		for(size_t i=0; i<grid.numCells(); ++i)
+		{
+			state ^= state << 13;
+			state ^= state >> 7;
+			state ^= state << 17;
+
+			if(state % 3 == 0)
+				grid.data()[i] = '#';
+		}
+
+		// Border cells that are alive, and a rule with births and
+		// survivals at every neighbor count.
+		const aoc::CellularAutomaton::LifeLikeRule rule = { 'o', '.', (1 << 0) | (1 << 3) | (1 << 6) | (1 << 8), (1 << 1) | (1 << 4) | (1 << 7) | (1 << 8) };
+
+		std::replace(grid.data(), grid.data() + grid.numCells(), '#', 'o');
+
+		auto genericRule = [&](const aoc::CellularAutomaton::Neighborhood& neighborhood)
+		{
+			const uint16_t counts = (neighborhood.cell() == 'o') ? rule.survivalCounts_ : rule.birthCounts_;
+
+			return ((counts >> neighborhood.count('o')) & 1) ? 'o' : '.';
+		};
+
+		aoc::CellularAutomaton automaton(grid, 'o', 3, 4);
+		aoc::CellularAutomaton expectedAutomaton(grid, 'o', 1);
+
+		for(int i=0; i<10; ++i)
+		{
+			automaton.step(rule);
+			expectedAutomaton.step(genericRule);
+
+			CHECK(automaton.toString() == expectedAutomaton.toString());
+		}
+	}
+
+	SUBCASE("exceptions")
+	{
+		aoc::CellularAutomaton automaton(lights, '.', 3, 2);
+
+		auto failingRule = [](const aoc::CellularAutomaton::Neighborhood& neighborhood) -> char
+		{
+			if(neighborhood.cell(-1, 1) == '#' && neighborhood.cell(0, 1) == '#' && neighborhood.cell(1, 1) == '#')
+				throw runtime_error("invalid cell");
+
+			return neighborhood.cell();
+		};
+
+		CHECK_THROWS_WITH_AS(automaton.step(failingRule), "invalid cell", runtime_error);
+	}
+}
+
+TEST_CASE("MathUtils")
+{
+	SUBCASE("isInRange")
+	{
+		CHECK(aoc::MathUtils::isInRange(1, 1, 10) == true);
+		CHECK(aoc::MathUtils::isInRange(5, 1, 10) == true);
+		CHECK(aoc::MathUtils::isInRange(10, 1, 10) == true);
+		CHECK(aoc::MathUtils::isInRange(0, 1, 10) == false);
+		CHECK(aoc::MathUtils::isInRange(11, 1, 10) == false);
+		CHECK(aoc::MathUtils::isInRange(-10, 1, 10) == false);
+		CHECK(aoc::MathUtils::isInRange(20, 1, 10) == false);
+		CHECK(aoc::MathUtils::isInRange(3, -1, 3) == true);
+	}
+
+	SUBCASE("manhattanDistance")
+	{
+		CHECK(aoc::MathUtils::manhattanDistance(0, 0, 0, 0) == 0);
+		CHECK(aoc::MathUtils::manhattanDistance(0, 0, 1, 0) == 1);
+		CHECK(aoc::MathUtils::manhattanDistance(0, 0, 0, 1) == 1);
+		CHECK(aoc::MathUtils::manhattanDistance(0, 0, 1, 1) == 2);
+		CHECK(aoc::MathUtils::manhattanDistance(1, 6, -1, 5) == 3);
+		CHECK(aoc::MathUtils::manhattanDistance(3, 5, -1, 5) == 4);
+		CHECK(aoc::MathUtils::manhattanDistance(2, 3, -1, 5) == 5);
+		CHECK(aoc::MathUtils::manhattanDistance(-6, 0, 0, 0) == 6);
+		CHECK(aoc::MathUtils::manhattanDistance(1, 1, 4, 5) == 7);
+	}
+}
+
+TEST_CASE("ParseUtils")
+{
+	SUBCASE("parseInteger")
+	{
+		size_t pos = 0;
+		int value = 0;
+
+		CHECK(aoc::ParseUtils::parseInteger("123 456", pos, value));
+		CHECK(value == 123);
+		CHECK(pos == 3);
+
+		CHECK(!aoc::ParseUtils::parseInteger("123 456", pos, value));
+		CHECK(pos == 3);
+
+		pos = 4;
+		CHECK(aoc::ParseUtils::parseInteger("123 456", pos, value));
+		CHECK(value == 456);
+		CHECK(pos == 7);
+
+		pos = 0;
+		CHECK(aoc::ParseUtils::parseInteger("-42:", pos, value));
+		CHECK(value == -42);
+		CHECK(pos == 3);
+
+		pos = 0;
+		CHECK(!aoc::ParseUtils::parseInteger("-", pos, value));
+		CHECK(!aoc::ParseUtils::parseInteger("x1", pos, value));
+		CHECK(!aoc::ParseUtils::parseInteger("", pos, value));
+		CHECK(pos == 0);
+
+		unsigned unsignedValue = 0;
+		CHECK(!aoc::ParseUtils::parseInteger("-1", pos, unsignedValue));
+	}
+
+	SUBCASE("parseInteger matches from_chars")
+	{
+		const vector<string> numbers = {
+			"0", "7", "12345678", "123456789", "0000000012345678", "1234567812345678",
+			"9223372036854775807", "-9223372036854775808", "-1234567890123", "00000000000000000000042"
+		};
+
+		for(const auto& number : numbers)
+		{
+			for(const char* suffix : { "", " ", ",12345678" })
+			{
+				const string str = number + suffix;
+
+				int64_t expectedValue = 0;
+				from_chars(number.data(), number.data() + number.size(), expectedValue);
+
+				size_t pos = 0;
+				int64_t value = 0;
+
+				CHECK(aoc::ParseUtils::parseInteger(str, pos, value));
+				CHECK(value == expectedValue);
+				CHECK(pos == number.size());
+			}
+		}
+
+		uint64_t value = 0;
+		size_t pos = 0;
+
+		CHECK(aoc::ParseUtils::parseInteger("18446744073709551615", pos, value));
+		CHECK(value == numeric_limits<uint64_t>::max());
+	}
+
+	SUBCASE("parseNextInteger")
+	{
+		const std::string_view str = "Game 12: 3 blue, -4 red; 5-6";
+
+		size_t pos = 0;
+		int value = 0;
+		vector<int> values;
+
+		while(aoc::ParseUtils::parseNextInteger(str, pos, value))
+			values.push_back(value);
+
+		CHECK(values == vector<int>({ 12, 3, -4, 5, -6 }));
+		CHECK(pos == str.size());
+
+		vector<unsigned> unsignedValues;
+		aoc::ParseUtils::parseIntegers(str, unsignedValues);
+
+		CHECK(unsignedValues == vector<unsigned>({ 12, 3, 4, 5, 6 }));
+	}
+
+	SUBCASE("toInteger")
+	{
+		CHECK(aoc::ParseUtils::toInteger<int>("42") == 42);
+		CHECK(aoc::ParseUtils::toInteger<int>("  -42 ") == -42);
+		CHECK(aoc::ParseUtils::toInteger<int64_t>("292") == 292);
+		CHECK(aoc::ParseUtils::toInteger<uint64_t>("253000") == 253000);
+	}
+
+	SUBCASE("skip")
+	{
+		size_t pos = 0;
+
+		aoc::ParseUtils::skipWhitespace(" \t x", pos);
+		CHECK(pos == 3);
+
+		pos = 0;
+		aoc::ParseUtils::skipDelimiters(", ;x", pos, ", ;");
+		CHECK(pos == 3);
+
+		pos = 0;
+		CHECK(aoc::ParseUtils::skipChar(":x", pos, ':'));
+		CHECK(pos == 1);
+		CHECK(!aoc::ParseUtils::skipChar(":x", pos, ':'));
+		CHECK(pos == 1);
+	}
+}
+
+TEST_CASE("Pattern")
+{
+	SUBCASE("constexpr elements")
+	{
+		constexpr aoc::PatternElement digits{ aoc::PatternElement::Type::Digits, 0, ".-" };
+
+		static_assert(digits.matches('7'));
+		static_assert(digits.matches('-'));
+		static_assert(!digits.matches('x'));
+		static_assert(aoc::ParseUtils::isWhitespace('\t'));
+	}
+
+	SUBCASE("fields")
+	{
+		char sideTag = 0;
+		size_t numBlocks = 0;
+
+		CHECK(aoc::Pattern<"{a}{d}">::numFields == 2);
+		CHECK(aoc::Pattern<"{a}{d}">::match("R42", sideTag, numBlocks));
+		CHECK(sideTag == 'R');
+		CHECK(numBlocks == 42);
+
+		CHECK(!aoc::Pattern<"{a}{d}">::match("R", sideTag, numBlocks));
+		CHECK(!aoc::Pattern<"{a}{d}">::match("RL4", sideTag, numBlocks));
+		CHECK(!aoc::Pattern<"{a}{d}">::match("R4x", sideTag, numBlocks));
+		CHECK(!aoc::Pattern<"{a}{d}">::match("", sideTag, numBlocks));
+
+		std::string_view name;
+		string checksum;
+		int sectorID = 0;
+
+		CHECK(aoc::Pattern<"{a-}-{d}[{a}]">::match("not-a-real-room-404[oarel]", name, sectorID, checksum));
+		CHECK(name == "not-a-real-room");
+		CHECK(sectorID == 404);
+		CHECK(checksum == "oarel");
+
+		CHECK(!aoc::Pattern<"{a-}-{d}[{a}]">::match("not-a-real-room-404[oarel]x", name, sectorID, checksum));
+		CHECK(!aoc::Pattern<"{a-}-{d}[{a}]">::match("not-a-real-room404[oarel]", name, sectorID, checksum));
+	}
+
+	SUBCASE("literals")
+	{
+		int x = 0;
+		int y = 0;
+
+		CHECK(aoc::Pattern<"p=<{d-},{d-}>">::match("p=<-3,12>", x, y));
+		CHECK(x == -3);
+		CHECK(y == 12);
+
+		CHECK(aoc::Pattern<"{{{d}}">::match("{7}", x));
+		CHECK(x == 7);
+
+		CHECK(aoc::Pattern<"move">::match("move"));
+		CHECK(!aoc::Pattern<"move">::match("mov"));
+	}
+}
+
+TEST_CASE("Tokenizer")
+{
+	SUBCASE("same tokens as getline")
+	{
+		const vector<string> strs = { "", ",", ",,", "a", "a,", ",a", "a,,b", " a , b ,c", "  ,  , x", "\t1\t,\n2 \r" };
+
+		for(const auto& str : strs)
+		{
+			for(bool trimWhitespace : { false, true })
+			{
+				for(bool skipEmptyTokens : { false, true })
+				{
+					vector<string> expectedTokens;
+					stringstream sin{str};
+					string token;
+
+					while(getline(sin, token, ','))
+						if(!skipEmptyTokens || !token.empty())
+							expectedTokens.push_back(trimWhitespace ? aoc::StringUtils::trim(token) : token);
+
+					vector<string> tokens;
+
+					for(const auto& token : aoc::Tokenizer(str, ',', trimWhitespace, skipEmptyTokens))
+						tokens.emplace_back(token);
+
+					CHECK(tokens == expectedTokens);
+					CHECK(aoc::StringUtils::tokenize(str, ',', trimWhitespace, skipEmptyTokens) == expectedTokens);
+				}
+			}
+		}
+	}
+
+	SUBCASE("fixed capacity")
+	{
+		std::string_view tokens[3];
+
+		CHECK(aoc::StringUtils::tokenize("  5  10   25", tokens, ' ', true, true) == 3);
+		CHECK(tokens[0] == "5");
+		CHECK(tokens[1] == "10");
+		CHECK(tokens[2] == "25");
+
+		CHECK(aoc::StringUtils::tokenize("1,2,3,4,5", tokens) == 5);
+		CHECK(tokens[2] == "3");
+
+		CHECK(aoc::StringUtils::tokenize("x", tokens) == 1);
+		CHECK(tokens[0] == "x");
+	}
+}
+
+TEST_CASE("StringUtils")
+{
+	SUBCASE("contains(const string& str, const string& substr)")
+	{
+		CHECK(aoc::StringUtils::contains("abc", "a"));
+		CHECK(aoc::StringUtils::contains("abc", "b"));
+		CHECK(aoc::StringUtils::contains("abc", "c"));
+		CHECK(aoc::StringUtils::contains("abc", "ab"));
+		CHECK(aoc::StringUtils::contains("abc", "bc"));
+		CHECK(aoc::StringUtils::contains("abc", "abc"));
+		CHECK(!aoc::StringUtils::contains("abc", "x"));
+		CHECK(!aoc::StringUtils::contains("abc", "ac"));
+		CHECK(!aoc::StringUtils::contains("abc", "acb"));
+	}
+
+	SUBCASE("contains(const string& str, char ch)")
+	{
+		CHECK(aoc::StringUtils::contains("abc", 'a'));
+		CHECK(aoc::StringUtils::contains("abc", 'b'));
+		CHECK(aoc::StringUtils::contains("abc", 'c'));
+		CHECK(!aoc::StringUtils::contains("abc", 'x'));
+	}
+
+	SUBCASE("countOverlappingSubstrings")
+	{
+		CHECK(aoc::StringUtils::countOverlappingSubstrings("", "a") == 0);
+		CHECK(aoc::StringUtils::countOverlappingSubstrings("a", "a") == 1);
+		CHECK(aoc::StringUtils::countOverlappingSubstrings("aa", "a") == 2);
+		CHECK(aoc::StringUtils::countOverlappingSubstrings("aaa", "a") == 3);
+		CHECK(aoc::StringUtils::countOverlappingSubstrings("a", "aa") == 0);
+
+		CHECK(aoc::StringUtils::countOverlappingSubstrings("", "bb") == 0);
+		CHECK(aoc::StringUtils::countOverlappingSubstrings("bb", "bb") == 1);
+		CHECK(aoc::StringUtils::countOverlappingSubstrings("bbb", "bb") == 2);
+		CHECK(aoc::StringUtils::countOverlappingSubstrings("bbbb", "bb") == 3);
+		CHECK(aoc::StringUtils::countOverlappingSubstrings("bb", "bbb") == 0);
+
+		CHECK(aoc::StringUtils::countOverlappingSubstrings("aaabbaaa", "aa") == 4);
+	}
+
+	SUBCASE("countNonOverlappingSubstrings")
+	{
+		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("", "a") == 0);
+		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("a", "a") == 1);
+		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("aa", "a") == 2);
+		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("aaa", "a") == 3);
+		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("a", "aa") == 0);
+
+		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("", "bb") == 0);
+		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("bb", "bb") == 1);
+		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("bbb", "bb") == 1);
+		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("bbbb", "bb") == 2);
+		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("bb", "bbb") == 0);
+
+		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("aaabbaaa", "aa") == 2);
+		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("aaaaaaa", "aa") == 3);
+		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("aaaaaaaa", "aa") == 4);
+		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("aaaaaaaaa", "aa") == 4);
+
+		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("MMMSXXMASM", "XMAS") == 1);
+	}
+
+	SUBCASE("countSubstrings")
+	{
+		const std::string_view substrs[] = { "XMAS", "SAMX", "A", "AA", "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA" };
+
+		string longStr;
+
+		for(size_t i=0; i<1000; ++i)
+			longStr += "XMAS"[(i * i + i / 7) % 4];
+
+		longStr += string(100, 'A') + "SAMXMAS";
+
+		// Strings shorter than the longest substring still have to count
+		// the shorter ones.
+		for(const string& str : { longStr, string(), string("A"), string("XMAS"), string("SAMXMASAAAA"), string(42, 'A') })
+		{
+			for(bool countOverlapping : { false, true })
+			{
+				size_t counts[AOC_NUM_ELEMENTS(substrs)] = {};
+
+				aoc::StringUtils::countSubstrings(str, substrs, counts, countOverlapping);
+
+				for(size_t k=0; k<AOC_NUM_ELEMENTS(substrs); ++k)
+				{
+					const string substr(substrs[k]);
+
+					CHECK(counts[k] == (countOverlapping ? aoc::StringUtils::countOverlappingSubstrings(str, substr)
+					                                     : aoc::StringUtils::countNonOverlappingSubstrings(str, substr)));
+
+					size_t expectedCount = 0;
+
+					for(size_t pos=str.find(substr); pos!=string::npos; pos=str.find(substr, pos + (countOverlapping ? 1 : substr.size())))
+						++expectedCount;
+
+					CHECK(counts[k] == expectedCount);
+				}
+			}
+		}
+	}
+
+	SUBCASE("replaceAll")
+	{
+		CHECK(aoc::StringUtils::replaceAll("one", "one", "1") == "1");
+		CHECK(aoc::StringUtils::replaceAll("twotwo", "two", "2") == "22");
+		CHECK(aoc::StringUtils::replaceAll("twoonetwo", "two", "2") == "2one2");
+		CHECK(aoc::StringUtils::replaceAll("one two three three", "three", "3") == "one two 3 3");
+		CHECK(aoc::StringUtils::replaceAll("one twoone three one one threeoneone", "one", "1") == "1 two1 three 1 1 three11");
+		CHECK(aoc::StringUtils::replaceAll("two1nine", "two", "2") == "21nine");
+	}
+
+	SUBCASE("replaceAll literal")
+	{
+		CHECK(aoc::StringUtils::replaceAll("a.b.c", ".", "+") == "a+b+c");
+		CHECK(aoc::StringUtils::replaceAll("f(x) = (x)", "(x)", "[y]") == "f[y] = [y]");
+		CHECK(aoc::StringUtils::replaceAll("aaaa", "aa", "b") == "bb");
+		CHECK(aoc::StringUtils::replaceAll("aaa", "aa", "b") == "ba");
+
+		string result = "previous contents";
+
+		aoc::StringUtils::replaceAll("one two one", "one", "", result);
+		CHECK(result == " two ");
+
+		aoc::StringUtils::replaceAll("no match", "xyz", "1", result);
+		CHECK(result == "no match");
+	}
+
+	SUBCASE("LiteralReplacer")
+	{
+		const aoc::LiteralReplacer digitReplacer({ { "one", "1" }, { "two", "2" }, { "three", "3" }, { "eight", "8" }, { "nine", "9" } });
+
+		CHECK(digitReplacer.numPatterns() == 5);
+		CHECK(digitReplacer.replaceAll("two1nine") == "219");
+		CHECK(digitReplacer.replaceAll("eightwothree") == "8wo3");
+		CHECK(digitReplacer.replaceAll("xtwone3four") == "x2ne3four");
+		CHECK(digitReplacer.replaceAll("") == "");
+
+		const aoc::LiteralReplacer replacer({ { "he", "1" }, { "she", "2" }, { "his", "3" }, { "hers", "4" }, { "a.b", "5" } });
+
+		string result;
+
+		replacer.replaceAll("ushers", result);
+		CHECK(result == "u2rs");
+
+		replacer.replaceAll("hishe a.b axb", result);
+		CHECK(result == "31 5 axb");
+	}
+
+	SUBCASE("LiteralReplacer matches brute force")
+	{
+		const vector<pair<string, string>> replacements = { { "a", "1" }, { "ab", "2" }, { "bab", "3" }, { "bb", "" }, { "aaa", "4" }, { "babb", "5" } };
+		const aoc::LiteralReplacer replacer(replacements);
+
+		auto bruteForceReplaceAll = [&](const string& str)
+		{
+			string result;
+			size_t copiedPos = 0;
+
+			for(size_t end=1; end<=str.size(); ++end)
+			{
+				const pair<string, string>* longestMatch = nullptr;
+
+				for(const auto& replacement : replacements)
+				{
+					const auto& pattern = replacement.first;
+
+					if((pattern.size() <= end - copiedPos) &&
+					   (str.compare(end - pattern.size(), pattern.size(), pattern) == 0) &&
+					   (!longestMatch || pattern.size() > longestMatch->first.size()))
+						longestMatch = &replacement;
+				}
+
+				if(longestMatch)
+				{
+					result += str.substr(copiedPos, end - longestMatch->first.size() - copiedPos) + longestMatch->second;
+					copiedPos = end;
+				}
+			}
+
+			return result + str.substr(copiedPos);
+		};
+
+		for(size_t i=0; i<(1 << 10); ++i)
+		{
+			string str;
+
+			for(size_t j=0; j<10; ++j)
+				str += ((i >> j) & 1) ? 'b' : 'a';
+
+			CHECK(replacer.replaceAll(str) == bruteForceReplaceAll(str));
+		}
+	}
+
+	SUBCASE("tokenize")
+	{
+		CHECK(aoc::StringUtils::tokenize("15 red, 1 green, 3 blue") == vector<string>({ "15 red", "1 green", "3 blue"}));
+		CHECK(aoc::StringUtils::tokenize("7  15   30", ' ', true, true) == vector<string>({ "7", "15", "30"}));
+	}
+
+	SUBCASE("trim(str)")
+	{
+		CHECK(aoc::StringUtils::trim(" test ") == "test");
+	}
+
+	SUBCASE("ltrim(str)")
+	{
+		CHECK(aoc::StringUtils::ltrim(" test") == "test");
+	}
+
+	SUBCASE("rtrim(str)")
+	{
+		CHECK(aoc::StringUtils::rtrim("test ") == "test");
+	}
+
+	SUBCASE("trim(str) matches regex")
+	{
+		const regex lhsWhitespaceRegex{"^[[:space:]]*", regex_constants::extended};
+		const regex rhsWhitespaceRegex{"[[:space:]]*$", regex_constants::extended};
+
+		const vector<string> strs = {
+			"", " ", "x", " x", "x ", "\t\n\v\f\r x y \r\f\v\n\t", "\x85x\xA0", string(1, '\0') + " ",
+			string(15, ' ') + "x" + string(17, '\t'), string(40, ' '), string(33, '\n') + "a b" + string(31, '\v'),
+			"a" + string(64, ' ') + "b", string(16, '\r') + string(16, '\x08') + string(16, '\x0E') + string(16, ' ')
+		};
+
+		for(const auto& str : strs)
+		{
+			const string ltrimmed = regex_replace(str, lhsWhitespaceRegex, "");
+			const string rtrimmed = regex_replace(str, rhsWhitespaceRegex, "");
+			const string trimmed = regex_replace(rtrimmed, lhsWhitespaceRegex, "");
+
+			CHECK(aoc::StringUtils::ltrim(str) == ltrimmed);
+			CHECK(aoc::StringUtils::rtrim(str) == rtrimmed);
+			CHECK(aoc::StringUtils::trim(str) == trimmed);
+			CHECK(aoc::StringUtils::ltrimView(str) == ltrimmed);
+			CHECK(aoc::StringUtils::rtrimView(str) == rtrimmed);
+			CHECK(aoc::StringUtils::trimView(str) == trimmed);
+		}
+	}
+
+	SUBCASE("trim(str, char)")
+	{
+		CHECK(aoc::StringUtils::trim("=test=", '=') == "test");
+	}
+
+	SUBCASE("ltrim(str, char)")
+	{
+		CHECK(aoc::StringUtils::ltrim("_test", '_') == "test");
+	}
+
+	SUBCASE("rtrim(str, char)")
+	{
+		CHECK(aoc::StringUtils::rtrim("test#", '#') == "test");
+	}
+
+	SUBCASE("generateVariations")
+	{
+		vector<string> variations;
+
+		aoc::StringUtils::generateVariations(set<char>({ 'a', 'b', 'c' }),
+		                                     2,
+		                                     variations);
+
+		CHECK(variations == vector<string>({ "aa", "ab", "ac", "ba", "bb", "bc", "ca", "cb", "cc" }));
+	}
+
+	SUBCASE("Variations")
+	{
+		const set<char> elements({ '+', '*', '|' });
+
+		CHECK(aoc::Variations(elements, 0).size() == 1);
+		CHECK(aoc::Variations(set<char>(), 2).size() == 0);
+
+		const aoc::Variations variations(elements, 5);
+
+		CHECK(variations.size() == 243);
+
+		vector<string> expectedVariations;
+
+		aoc::StringUtils::generateVariations(elements, 5, expectedVariations);
+
+		size_t ordinal = 0;
+
+		for(auto it=variations.begin(); it!=variations.end(); ++it, ++ordinal)
+		{
+			CHECK(it.ordinal() == ordinal);
+			CHECK(*it == expectedVariations[ordinal]);
+			CHECK(variations[ordinal] == expectedVariations[ordinal]);
+		}
+
+		CHECK(ordinal == expectedVariations.size());
+
+		auto it = variations.iteratorAt(100);
+
+		for(size_t i=100; i<150; ++i, ++it)
+			CHECK(*it == expectedVariations[i]);
+	}
+}
+
+#endif // #if defined(AOC_TEST)
+
+#if defined(AOC_BENCHMARK)
+
+template<class Function>
+double measureBestSeconds(Function&& function, size_t numRepetitions=5)
+{
+	double bestSeconds = numeric_limits<double>::max();
+
+	for(size_t i=0; i<numRepetitions; ++i)
+	{
+		const auto startTime = chrono::steady_clock::now();
+
+		function();
+
+		const chrono::duration<double> elapsedTime = chrono::steady_clock::now() - startTime;
+
+		bestSeconds = min(bestSeconds, elapsedTime.count());
+	}
+
+	return bestSeconds;
+}
+
+void printThroughput(const char* name, size_t numBytes, double seconds)
+{
+	println("{:<40} {:8.3f} GB/s", name, numBytes / seconds / 1e9);
+}
+
+void printCostPerItem(const char* name, size_t numItems, const char* itemName, double seconds)
+{
+	println("{:<40} {:8.1f} ns/{}", name, seconds / numItems * 1e9, itemName);
+}
+
+void printItemsPerSecond(const char* name, size_t numItems, const char* itemName, double seconds)
+{
+	println("{:<40} {:8.1f} M {}s/s", name, numItems / seconds / 1e6, itemName);
+}
+
+string generateLines(size_t numBytes)
+{
+	string buffer;
+
+	buffer.reserve(numBytes + 128);
+
+	for(size_t i=0; buffer.size()<numBytes; ++i)
+		buffer += string(8 + (i * 7919) % 73, 'a' + i % 26) + '\n';
+
+	return buffer;
+}
+
+void benchmarkNewlineIndexing()
+{
+	const string buffer = generateLines(256 << 20);
+
+	size_t numLines = 0;
+
+	const double getlineSeconds = measureBestSeconds([&]()
+	{
+		istringstream sin(buffer);
+		string line;
+		vector<string> lines;
+
+		while(getline(sin, line))
+			lines.push_back(line);
+
+		numLines = lines.size();
+	});
+
+	const double findNewlinesSeconds = measureBestSeconds([&]()
+	{
+		vector<size_t> newlineOffsets;
+
+		aoc::findNewlines(buffer, newlineOffsets);
+
+		AOC_ENFORCE(newlineOffsets.size() == numLines);
+	});
+
+	const double splitLinesSeconds = measureBestSeconds([&]()
+	{
+		vector<std::string_view> lines;
+
+		aoc::splitLines(buffer, lines);
+
+		AOC_ENFORCE(lines.size() == numLines);
+	});
+
+	println("newline indexing ({} MB, {} lines)", buffer.size() >> 20, numLines);
+	printThroughput("  getline into vector<string>", buffer.size(), getlineSeconds);
+	printThroughput("  findNewlines", buffer.size(), findNewlinesSeconds);
+	printThroughput("  splitLines", buffer.size(), splitLinesSeconds);
+}
+
+void benchmarkIntegerParsing()
+{
+	string buffer;
+
+	buffer.reserve((64 << 20) + 32);
+
+	for(size_t i=0; buffer.size()<(64 << 20); ++i)
+		buffer += to_string((i * 2654435761u) % (i % 3 == 0 ? 1000 : 1000000000000)) + ((i % 8 == 7) ? '\n' : ' ');
+
+	vector<std::string_view> tokens;
+
+	for(size_t pos=0; pos<buffer.size();)
+	{
+		const size_t endPos = buffer.find_first_of(" \n", pos);
+
+		tokens.push_back(std::string_view(buffer).substr(pos, endPos - pos));
+		pos = endPos + 1;
+	}
+
+	int64_t expectedSum = 0;
+
+	const double stollSeconds = measureBestSeconds([&]()
+	{
+		int64_t sum = 0;
+
+		for(const auto& token : tokens)
+			sum += stoll(string(token));
+
+		expectedSum = sum;
+	});
+
+	const double strtollSeconds = measureBestSeconds([&]()
+	{
+		int64_t sum = 0;
+
+		for(const auto& token : tokens)
+			sum += strtoll(token.data(), nullptr, 10);
+
+		AOC_ENFORCE(sum == expectedSum);
+	});
+
+	const double fromCharsSeconds = measureBestSeconds([&]()
+	{
+		int64_t sum = 0;
+
+		for(const auto& token : tokens)
+		{
+			int64_t value = 0;
+			from_chars(token.data(), token.data() + token.size(), value);
+			sum += value;
+		}
+
+		AOC_ENFORCE(sum == expectedSum);
+	});
+
+	const double parseIntegerSeconds = measureBestSeconds([&]()
+	{
+		int64_t sum = 0;
+
+		for(const auto& token : tokens)
+		{
+			size_t pos = 0;
+			int64_t value = 0;
+			aoc::ParseUtils::parseInteger(token, pos, value);
+			sum += value;
+		}
+
+		AOC_ENFORCE(sum == expectedSum);
+	});
+
+	const double parseNextIntegerSeconds = measureBestSeconds([&]()
+	{
+		int64_t sum = 0;
+		size_t pos = 0;
+		int64_t value = 0;
+
+		while(aoc::ParseUtils::parseNextInteger(buffer, pos, value))
+			sum += value;
+
+		AOC_ENFORCE(sum == expectedSum);
+	});
+
+	println("integer parsing ({} MB, {} integers)", buffer.size() >> 20, tokens.size());
+	printThroughput("  stoll(string(token))", buffer.size(), stollSeconds);
+	printThroughput("  strtoll", buffer.size(), strtollSeconds);
+	printThroughput("  from_chars", buffer.size(), fromCharsSeconds);
+	printThroughput("  ParseUtils::parseInteger", buffer.size(), parseIntegerSeconds);
+	printThroughput("  ParseUtils::parseNextInteger", buffer.size(), parseNextIntegerSeconds);
+}
+
+// The regex-based implementations StringUtils used to have, kept as the
+// "before" numbers of benchmarkTokenizing().
+string regexTrim(const string& str)
+{
+	static const regex lhsWhitespaceRegex{"^[[:space:]]*", regex_constants::extended};
+	static const regex rhsWhitespaceRegex{"[[:space:]]*$", regex_constants::extended};
+
+	return regex_replace(regex_replace(str, rhsWhitespaceRegex, ""), lhsWhitespaceRegex, "");
+}
+
+vector<string> regexTokenize(const string& str, char delimiter, bool trimWhitespace, bool skipEmptyTokens)
+{
+	vector<string> tokens;
+	stringstream sin{str};
+	string token;
+
+	while(getline(sin, token, delimiter))
+		if(!skipEmptyTokens || !token.empty())
+			tokens.push_back(trimWhitespace ? regexTrim(token) : token);
+
+	return tokens;
+}
+
+void benchmarkTokenizing()
+{
+	vector<string> lines;
+	size_t numBytes = 0;
+
+	for(size_t i=0; numBytes<(4 << 20); ++i)
+	{
+		lines.push_back(format("  {:>3} {:>4},{:>4}  ", i % 997, (i * 7) % 1000, (i * 13) % 1000));
+		numBytes += lines.back().size() + 1;
+	}
+
+	int64_t expectedSum = 0;
+
+	const double regexTokenizeSeconds = measureBestSeconds([&]()
+	{
+		int64_t sum = 0;
+
+		for(const auto& line : lines)
+			for(const auto& token : regexTokenize(line, ',', true, true))
+				for(const auto& number : regexTokenize(token, ' ', true, true))
+					sum += stoll(number);
+
+		expectedSum = sum;
+	}, 1);
+
+	const double tokenizeSeconds = measureBestSeconds([&]()
+	{
+		int64_t sum = 0;
+
+		for(const auto& line : lines)
+			for(const auto& token : aoc::StringUtils::tokenize(line, ',', true, true))
+				for(const auto& number : aoc::StringUtils::tokenize(token, ' ', true, true))
+					sum += aoc::ParseUtils::toInteger<int64_t>(number);
+
+		AOC_ENFORCE(sum == expectedSum);
+	});
+
+	const double tokenizerSeconds = measureBestSeconds([&]()
+	{
+		int64_t sum = 0;
+
+		for(const auto& line : lines)
+			for(const auto& token : aoc::Tokenizer(line, ',', true, true))
+				for(const auto& number : aoc::Tokenizer(token, ' ', true, true))
+					sum += aoc::ParseUtils::toInteger<int64_t>(number);
+
+		AOC_ENFORCE(sum == expectedSum);
+	});
+
+	size_t expectedSize = 0;
+
+	const double regexTrimSeconds = measureBestSeconds([&]()
+	{
+		size_t size = 0;
+
+		for(const auto& line : lines)
+			size += regexTrim(line).size();
+
+		expectedSize = size;
+	}, 1);
+
+	const double trimSeconds = measureBestSeconds([&]()
+	{
+		size_t size = 0;
+
+		for(const auto& line : lines)
+			size += aoc::StringUtils::trim(line).size();
+
+		AOC_ENFORCE(size == expectedSize);
+	});
+
+	const double trimViewSeconds = measureBestSeconds([&]()
+	{
+		size_t size = 0;
+
+		for(const auto& line : lines)
+			size += aoc::StringUtils::trimView(line).size();
+
+		AOC_ENFORCE(size == expectedSize);
+	});
+
+	println("tokenizing ({} MB, {} lines)", numBytes >> 20, lines.size());
+	printThroughput("  regex tokenize + stoll (before)", numBytes, regexTokenizeSeconds);
+	printThroughput("  StringUtils::tokenize + toInteger", numBytes, tokenizeSeconds);
+	printThroughput("  Tokenizer + toInteger", numBytes, tokenizerSeconds);
+	printThroughput("  regex trim (before)", numBytes, regexTrimSeconds);
+	printThroughput("  StringUtils::trim", numBytes, trimSeconds);
+	printThroughput("  StringUtils::trimView", numBytes, trimViewSeconds);
+}
+
+void benchmarkReplacing()
+{
+	const vector<pair<string, string>> replacements = {
+		{ "ERROR", "E" }, { "WARNING", "W" }, { "INFO", "I" }, { "DEBUG", "D" },
+		{ "connection", "conn" }, { "request", "req" }, { "response", "resp" }, { "timeout", "t/o" }
+	};
+
+	const char* levels[] = { "INFO", "DEBUG", "WARNING", "ERROR" };
+	const char* messages[] = { "request accepted", "response sent", "connection closed", "timeout waiting for response" };
+
+	string log;
+
+	for(size_t i=0; log.size()<(16 << 20); ++i)
+		log += format("2024-12-{:02} {:>7} [worker {}] {} id={}\n", 1 + i % 25, levels[i % 4], i % 16, messages[(i * 7) % 4], i);
+
+	string expectedResult;
+	string result;
+
+	const double regexSeconds = measureBestSeconds([&]()
+	{
+		result = regex_replace(log, regex("request"), "req");
+	}, 1);
+
+	expectedResult = result;
 
-		aoc::BoundedGrid2D<char>::Row row1 = grid.row(1);
+	const double literalSeconds = measureBestSeconds([&]()
+	{
+		aoc::StringUtils::replaceAll(log, "request", "req", result);
 
-		for(size_t i=0; i<row1.length(); ++i)
-			CHECK(row1[i] == '1');
+		AOC_ENFORCE(result == expectedResult);
+	});
 
-		CHECK(grid.constRow(0).toString() == "00000000000000");
-		CHECK(grid.constRow(1).toString() == "11111111111111");
-		CHECK(grid.constRow(2).toString() == "22222222222222");
+	const double regexDictionarySeconds = measureBestSeconds([&]()
+	{
+		result = log;
 
-		aoc::BoundedGrid2D<char>::ConstRow constRow1 = grid.constRow(1);
+		for(const auto& [pattern, replacement] : replacements)
+			result = regex_replace(result, regex(pattern), replacement);
+	}, 1);
 
-		for(size_t i=0; i<constRow1.length(); ++i)
-			CHECK(constRow1[i] == '1');
-	}
+	expectedResult = result;
 
-	SUBCASE("reverseRow")
+	const double literalDictionarySeconds = measureBestSeconds([&]()
 	{
-		const vector<string> lines =
+		string buffer;
+
+		result = log;
+
+		for(const auto& [pattern, replacement] : replacements)
 		{
-			"abcdefghijklm",
-			"nopqrstuvwxyz",
-		};
+			aoc::StringUtils::replaceAll(result, pattern, replacement, buffer);
+			result.swap(buffer);
+		}
 
-		aoc::BoundedGrid2D<char> grid(lines);
+		AOC_ENFORCE(result == expectedResult);
+	});
 
-		CHECK(grid.reverseRow(0).toString() == "mlkjihgfedcba");
-		CHECK(grid.reverseRow(1).toString() == "zyxwvutsrqpon");
+	const aoc::LiteralReplacer replacer(replacements);
 
-		aoc::BoundedGrid2D<char>::ReverseRow reverseRow0 = grid.reverseRow(0);
+	const double literalReplacerSeconds = measureBestSeconds([&]()
+	{
+		replacer.replaceAll(log, result);
 
-		for(size_t i=0; i<reverseRow0.length(); ++i)
-			CHECK(reverseRow0[i] == lines[0][13-i-1]);
+		AOC_ENFORCE(result == expectedResult);
+	});
 
-		CHECK(grid.constReverseRow(0).toString() == "mlkjihgfedcba");
-		CHECK(grid.constReverseRow(1).toString() == "zyxwvutsrqpon");
+	println("replacing ({} MB, {} patterns)", log.size() >> 20, replacements.size());
+	printThroughput("  regex_replace, one pattern (before)", log.size(), regexSeconds);
+	printThroughput("  StringUtils::replaceAll, one pattern", log.size(), literalSeconds);
+	printThroughput("  regex_replace per pattern (before)", log.size(), regexDictionarySeconds);
+	printThroughput("  StringUtils::replaceAll per pattern", log.size(), literalDictionarySeconds);
+	printThroughput("  LiteralReplacer", log.size(), literalReplacerSeconds);
+}
 
-		aoc::BoundedGrid2D<char>::ConstReverseRow constReverseRow0 = grid.constReverseRow(0);
+// 202404-style word search, comparing the find-based counting of every
+// line and its reverse with counting a word and its reverse in one pass.
+void benchmarkSubstringCounting()
+{
+	constexpr size_t gridSize = 10000;
 
-		for(size_t i=0; i<constReverseRow0.length(); ++i)
-			CHECK(constReverseRow0[i] == lines[0][13-i-1]);
-	}
+	vector<string> lines(gridSize, string(gridSize, ' '));
 
-	SUBCASE("column")
+	for(size_t y=0; y<gridSize; ++y)
+		for(size_t x=0; x<gridSize; ++x)
+			lines[y][x] = "XMAS"[((x * 7919) ^ (y * 104729) ^ (x * y)) % 4];
+
+	const aoc::BoundedGrid2D<char> wordSearch(lines);
+	const string word = "XMAS";
+	const string reverseWord = "SAMX";
+
+	auto forEachLine = [&](auto&& function)
 	{
-		const vector<string> lines =
-		{
-			"0ak",
-			"1bl",
-			"2cm",
-			"3dn",
-			"4eo",
-			"5fp",
-			"6gq",
-			"7hr",
-			"8is",
-			"9jt",
-		};
+		for(size_t y=0; y<wordSearch.height(); ++y)
+			function(wordSearch.constRow(y).toString());
 
-		aoc::BoundedGrid2D<char> grid(lines);
+		for(size_t x=0; x<wordSearch.width(); ++x)
+			function(wordSearch.constColumn(x).toString());
 
-		CHECK(grid.column(0).toString() == "0123456789");
-		CHECK(grid.column(1).toString() == "abcdefghij");
-		CHECK(grid.column(2).toString() == "klmnopqrst");
+		for(size_t i=0; i<wordSearch.numDiagonals(); ++i)
+		{
+			function(wordSearch.constTopDownDiagonal(i).toString());
+			function(wordSearch.constBottomUpDiagonal(i).toString());
+		}
+	};
 
-		aoc::BoundedGrid2D<char>::Column column1 = grid.column(1);
+	vector<string> allLines;
+	size_t numBytes = 0;
 
-		for(size_t i=0; i<column1.length(); ++i)
-			CHECK(column1[i] == 'a' + i);
+	forEachLine([&](string line)
+	{
+		numBytes += line.size();
+		allLines.push_back(std::move(line));
+	});
 
-		CHECK(grid.constColumn(0).toString() == "0123456789");
-		CHECK(grid.constColumn(1).toString() == "abcdefghij");
-		CHECK(grid.constColumn(2).toString() == "klmnopqrst");
+	auto findCount = [](const string& str, const string& substr)
+	{
+		size_t count = 0;
 
-		aoc::BoundedGrid2D<char>::ConstColumn constColumn1 = grid.constColumn(1);
+		for(size_t pos=str.find(substr); pos!=string::npos; pos=str.find(substr, pos + substr.size()))
+			++count;
 
-		for(size_t i=0; i<constColumn1.length(); ++i)
-			CHECK(constColumn1[i] == 'a' + i);
-	}
+		return count;
+	};
 
-	SUBCASE("reverseColumn")
+	size_t expectedCount = 0;
+
+	const double findSeconds = measureBestSeconds([&]()
 	{
-		const vector<string> lines =
+		size_t count = 0;
+
+		for(const auto& line : allLines)
 		{
-			"an",
-			"bo",
-			"cp",
-			"dq",
-			"er",
-			"fs",
-			"gt",
-			"hu",
-			"iv",
-			"jw",
-			"kx",
-			"ly",
-			"mz",
-		};
+			count += findCount(line, word);
+			count += findCount(string(line.rbegin(), line.rend()), word);
+		}
 
-		aoc::BoundedGrid2D<char> grid(lines);
+		expectedCount = count;
+	}, 1);
 
-		CHECK(grid.reverseColumn(0).toString() == "mlkjihgfedcba");
-		CHECK(grid.reverseColumn(1).toString() == "zyxwvutsrqpon");
+	const double countSubstringsSeconds = measureBestSeconds([&]()
+	{
+		const std::string_view words[] = { word, reverseWord };
 
-		aoc::BoundedGrid2D<char>::ReverseColumn reverseColumn0 = grid.reverseColumn(0);
+		size_t counts[2] = { 0, 0 };
 
-		for(size_t i=0; i<reverseColumn0.length(); ++i)
-			CHECK(reverseColumn0[i] == lines[13-i-1][0]);
+		for(const auto& line : allLines)
+			aoc::StringUtils::countSubstrings(line, words, counts);
 
-		CHECK(grid.constReverseColumn(0).toString() == "mlkjihgfedcba");
-		CHECK(grid.constReverseColumn(1).toString() == "zyxwvutsrqpon");
+		AOC_ENFORCE(counts[0] + counts[1] == expectedCount);
+	}, 3);
 
-		aoc::BoundedGrid2D<char>::ConstReverseColumn constReverseColumn0 = grid.constReverseColumn(0);
+	const double countWordSeconds = measureBestSeconds([&]()
+	{
+		const std::string_view words[] = { word, reverseWord };
 
-		for(size_t i=0; i<constReverseColumn0.length(); ++i)
-			CHECK(constReverseColumn0[i] == lines[13-i-1][0]);
-	}
+		size_t counts[2] = { 0, 0 };
 
-	SUBCASE("topDownDiagonal")
-	{
-		const vector<string> lines1 =
+		forEachLine([&](const string& line)
 		{
-			"abcde",
-			"fghij",
-			"klmno",
-		};
-
-		aoc::BoundedGrid2D<char> grid(lines1);
+			aoc::StringUtils::countSubstrings(line, words, counts);
+		});
 
-		CHECK(grid.topDownDiagonal(0).toString() == "k");
-		CHECK(grid.topDownDiagonal(1).toString() == "fl");
-		CHECK(grid.topDownDiagonal(2).toString() == "agm");
-		CHECK(grid.topDownDiagonal(3).toString() == "bhn");
-		CHECK(grid.topDownDiagonal(4).toString() == "cio");
-		CHECK(grid.topDownDiagonal(5).toString() == "dj");
-		CHECK(grid.topDownDiagonal(6).toString() == "e");
+		AOC_ENFORCE(counts[0] + counts[1] == expectedCount);
+	}, 1);
 
-		const vector<string> lines2 =
-		{
-			"abcd",
-			"efgh",
-			"ijkl",
-			"mnop",
-		};
+	const double gridIteratorsSeconds = measureBestSeconds([&]()
+	{
+		const std::string_view words[] = { word, reverseWord };
 
-		grid.reset(lines2);
+		size_t counts[2] = { 0, 0 };
 
-		CHECK(grid.topDownDiagonal(0).toString() == "m");
-		CHECK(grid.topDownDiagonal(1).toString() == "in");
-		CHECK(grid.topDownDiagonal(2).toString() == "ejo");
-		CHECK(grid.topDownDiagonal(3).toString() == "afkp");
-		CHECK(grid.topDownDiagonal(4).toString() == "bgl");
-		CHECK(grid.topDownDiagonal(5).toString() == "ch");
-		CHECK(grid.topDownDiagonal(6).toString() == "d");
+		string line;
 
-		const vector<string> lines3 =
+		auto countWords = [&](const auto& sequence)
 		{
-			"abcd",
+			line.assign(sequence.begin(), sequence.end());
+
+			aoc::StringUtils::countSubstrings(line, words, counts);
 		};
 
-		grid.reset(lines3);
+		for(size_t y=0; y<wordSearch.height(); ++y)
+		{
+			const auto row = wordSearch.constRow(y);
 
-		CHECK(grid.topDownDiagonal(0).toString() == "a");
-		CHECK(grid.topDownDiagonal(1).toString() == "b");
-		CHECK(grid.topDownDiagonal(2).toString() == "c");
-		CHECK(grid.topDownDiagonal(3).toString() == "d");
+			aoc::StringUtils::countSubstrings(std::string_view(row.begin(), row.end()), words, counts);
+		}
 
-		const vector<string> lines4 =
+		for(size_t x=0; x<wordSearch.width(); ++x)
+			countWords(wordSearch.constColumn(x));
+
+		for(size_t i=0; i<wordSearch.numDiagonals(); ++i)
 		{
-			"abcdefgh",
-		};
+			countWords(wordSearch.constTopDownDiagonal(i));
+			countWords(wordSearch.constBottomUpDiagonal(i));
+		}
 
-		grid.reset(lines4);
+		AOC_ENFORCE(counts[0] + counts[1] == expectedCount);
+	}, 1);
 
-		CHECK(grid.topDownDiagonal(0).toString() == "a");
-		CHECK(grid.topDownDiagonal(1).toString() == "b");
-		CHECK(grid.topDownDiagonal(2).toString() == "c");
-		CHECK(grid.topDownDiagonal(3).toString() == "d");
-		CHECK(grid.topDownDiagonal(4).toString() == "e");
-		CHECK(grid.topDownDiagonal(5).toString() == "f");
-		CHECK(grid.topDownDiagonal(6).toString() == "g");
-		CHECK(grid.topDownDiagonal(7).toString() == "h");
+	const double gridWordSearchSeconds = measureBestSeconds([&]()
+	{
+		AOC_ENFORCE(aoc::GridWordSearch::countWord(wordSearch, word) == expectedCount);
+	}, 3);
+
+	println("substring counting ({}x{} grid, {} MB of lines, {} matches)", gridSize, gridSize, numBytes >> 20, expectedCount);
+	printThroughput("  find, line + reversed line (before)", numBytes, findSeconds);
+	printThroughput("  countSubstrings, word + reverse", numBytes, countSubstringsSeconds);
+	printThroughput("  countWord incl. extracting lines", numBytes, countWordSeconds);
+	printThroughput("  countWord over grid iterators", numBytes, gridIteratorsSeconds);
+	printThroughput("  GridWordSearch, all 8 directions", numBytes, gridWordSearchSeconds);
+}
+
+void benchmarkPatternMatching()
+{
+	vector<string> instructions;
+	vector<string> roomListEntries;
+
+	for(size_t i=0; i<(1 << 20); ++i)
+	{
+		instructions.push_back(format("{}{}", (i % 3) ? 'L' : 'R', (i * 7919) % 1000));
+		roomListEntries.push_back(format("{}-{}-{}-{}[{}]",
+		                                 string(3 + i % 9, 'a' + i % 26),
+		                                 string(2 + i % 5, 'a' + (i / 26) % 26),
+		                                 string(4 + i % 7, 'a' + (i / 7) % 26),
+		                                 100 + (i * 31) % 900,
+		                                 string(5, 'a' + (i / 3) % 26)));
 	}
 
-	SUBCASE("constTopDownDiagonal")
+	size_t expectedSum = 0;
+
+	const double instructionRegexSeconds = measureBestSeconds([&]()
 	{
-		const vector<string> lines1 =
+		static const regex instructionRegex(R"((L|R)(\d+))");
+
+		size_t sum = 0;
+		smatch instructionMatch;
+
+		for(const auto& instruction : instructions)
 		{
-			"abcde",
-			"fghij",
-			"klmno",
-		};
+			AOC_ENFORCE(regex_match(instruction, instructionMatch, instructionRegex));
 
-		aoc::BoundedGrid2D<char> grid(lines1);
+			sum += instructionMatch[1].str()[0] + stoi(instructionMatch[2].str());
+		}
 
-		CHECK(grid.constTopDownDiagonal(0).toString() == "k");
-		CHECK(grid.constTopDownDiagonal(1).toString() == "fl");
-		CHECK(grid.constTopDownDiagonal(2).toString() == "agm");
-		CHECK(grid.constTopDownDiagonal(3).toString() == "bhn");
-		CHECK(grid.constTopDownDiagonal(4).toString() == "cio");
-		CHECK(grid.constTopDownDiagonal(5).toString() == "dj");
-		CHECK(grid.constTopDownDiagonal(6).toString() == "e");
+		expectedSum = sum;
+	}, 1);
 
-		const vector<string> lines2 =
+	const double instructionPatternSeconds = measureBestSeconds([&]()
+	{
+		size_t sum = 0;
+
+		for(const auto& instruction : instructions)
 		{
-			"abcd",
-			"efgh",
-			"ijkl",
-			"mnop",
-		};
+			char sideTag = 0;
+			size_t numBlocks = 0;
 
-		grid.reset(lines2);
+			AOC_ENFORCE(aoc::Pattern<"{a}{d}">::match(instruction, sideTag, numBlocks));
 
-		CHECK(grid.constTopDownDiagonal(0).toString() == "m");
-		CHECK(grid.constTopDownDiagonal(1).toString() == "in");
-		CHECK(grid.constTopDownDiagonal(2).toString() == "ejo");
-		CHECK(grid.constTopDownDiagonal(3).toString() == "afkp");
-		CHECK(grid.constTopDownDiagonal(4).toString() == "bgl");
-		CHECK(grid.constTopDownDiagonal(5).toString() == "ch");
-		CHECK(grid.constTopDownDiagonal(6).toString() == "d");
+			sum += sideTag + numBlocks;
+		}
 
-		const vector<string> lines3 =
-		{
-			"abcd",
-		};
+		AOC_ENFORCE(sum == expectedSum);
+	});
 
-		grid.reset(lines3);
+	const double roomListEntryRegexSeconds = measureBestSeconds([&]()
+	{
+		static const regex roomListEntryRegex(R"(([a-z][a-z\-]+[a-z])-(\d+)\[([a-z]+)\])");
 
-		CHECK(grid.constTopDownDiagonal(0).toString() == "a");
-		CHECK(grid.constTopDownDiagonal(1).toString() == "b");
-		CHECK(grid.constTopDownDiagonal(2).toString() == "c");
-		CHECK(grid.constTopDownDiagonal(3).toString() == "d");
+		size_t sum = 0;
+		smatch roomListEntryMatch;
 
-		const vector<string> lines4 =
+		for(const auto& roomListEntry : roomListEntries)
 		{
-			"abcdefgh",
-		};
+			AOC_ENFORCE(regex_match(roomListEntry, roomListEntryMatch, roomListEntryRegex));
 
-		grid.reset(lines4);
+			sum += roomListEntryMatch[1].length() + stoi(roomListEntryMatch[2]) + roomListEntryMatch[3].length();
+		}
 
-		CHECK(grid.constTopDownDiagonal(0).toString() == "a");
-		CHECK(grid.constTopDownDiagonal(1).toString() == "b");
-		CHECK(grid.constTopDownDiagonal(2).toString() == "c");
-		CHECK(grid.constTopDownDiagonal(3).toString() == "d");
-		CHECK(grid.constTopDownDiagonal(4).toString() == "e");
-		CHECK(grid.constTopDownDiagonal(5).toString() == "f");
-		CHECK(grid.constTopDownDiagonal(6).toString() == "g");
-		CHECK(grid.constTopDownDiagonal(7).toString() == "h");
-	}
+		expectedSum = sum;
+	}, 1);
 
-	SUBCASE("reverseTopDownDiagonal")
+	const double roomListEntryPatternSeconds = measureBestSeconds([&]()
 	{
-		const vector<string> lines1 =
+		size_t sum = 0;
+
+		for(const auto& roomListEntry : roomListEntries)
 		{
-			"abcde",
-			"fghij",
-			"klmno",
-		};
+			std::string_view encryptedName;
+			int sectorID = 0;
+			std::string_view checksum;
 
-		aoc::BoundedGrid2D<char> grid(lines1);
+			AOC_ENFORCE(aoc::Pattern<"{a-}-{d}[{a}]">::match(roomListEntry, encryptedName, sectorID, checksum));
 
-		CHECK(grid.reverseTopDownDiagonal(0).toString() == "k");
-		CHECK(grid.reverseTopDownDiagonal(1).toString() == "lf");
-		CHECK(grid.reverseTopDownDiagonal(2).toString() == "mga");
-		CHECK(grid.reverseTopDownDiagonal(3).toString() == "nhb");
-		CHECK(grid.reverseTopDownDiagonal(4).toString() == "oic");
-		CHECK(grid.reverseTopDownDiagonal(5).toString() == "jd");
-		CHECK(grid.reverseTopDownDiagonal(6).toString() == "e");
+			sum += encryptedName.size() + sectorID + checksum.size();
+		}
 
-		const vector<string> lines2 =
-		{
-			"abcd",
-			"efgh",
-			"ijkl",
-			"mnop",
-		};
+		AOC_ENFORCE(sum == expectedSum);
+	});
+
+	println("pattern matching ({} lines per grammar)", instructions.size());
+	printCostPerItem("  201601 instruction, regex_match", instructions.size(), "line", instructionRegexSeconds);
+	printCostPerItem("  201601 instruction, Pattern", instructions.size(), "line", instructionPatternSeconds);
+	printCostPerItem("  201604 room list entry, regex_match", roomListEntries.size(), "line", roomListEntryRegexSeconds);
+	printCostPerItem("  201604 room list entry, Pattern", roomListEntries.size(), "line", roomListEntryPatternSeconds);
+}
+
+void benchmarkGridScanning()
+{
+	aoc::BoundedGrid2D<char> grid(10000, 10000, '.');
+
+	for(size_t i=0; i<grid.numCells(); i+=7)
+		grid.data()[i] = '#';
+
+	grid.setCell(9999, 9999, '^');
+
+	const size_t expectedCount = (grid.numCells() + 6) / 7;
+
+	const double scalarCountSeconds = measureBestSeconds([&]()
+	{
+		size_t count = 0;
+
+		for(size_t y=0; y<grid.height(); ++y)
+			for(size_t x=0; x<grid.width(); ++x)
+				if(grid.cell(x, y) == '#')
+					++count;
+
+		AOC_ENFORCE(count == expectedCount);
+	});
+
+	const double countSeconds = measureBestSeconds([&]()
+	{
+		AOC_ENFORCE(grid.count('#') == expectedCount);
+	});
+
+	auto scalarFindCell = [&](char cell)
+	{
+		for(size_t y=0; y<grid.height(); ++y)
+			for(size_t x=0; x<grid.width(); ++x)
+				if(grid.cell(x, y) == cell)
+					return aoc::Point2uz(x, y);
 
-		grid.reset(lines2);
+		return aoc::Point2uz(aoc::BoundedGrid2D<char>::npos, aoc::BoundedGrid2D<char>::npos);
+	};
 
-		CHECK(grid.reverseTopDownDiagonal(0).toString() == "m");
-		CHECK(grid.reverseTopDownDiagonal(1).toString() == "ni");
-		CHECK(grid.reverseTopDownDiagonal(2).toString() == "oje");
-		CHECK(grid.reverseTopDownDiagonal(3).toString() == "pkfa");
-		CHECK(grid.reverseTopDownDiagonal(4).toString() == "lgb");
-		CHECK(grid.reverseTopDownDiagonal(5).toString() == "hc");
-		CHECK(grid.reverseTopDownDiagonal(6).toString() == "d");
+	const double scalarFindSeconds = measureBestSeconds([&]()
+	{
+		aoc::Point2uz position;
 
-		const vector<string> lines3 =
+		for(char directionChar : { '^', '>', 'v', '<' })
 		{
-			"abcd",
-		};
+			position = scalarFindCell(directionChar);
 
-		grid.reset(lines3);
+			if(position.x_ != aoc::BoundedGrid2D<char>::npos)
+				break;
+		}
 
-		CHECK(grid.reverseTopDownDiagonal(0).toString() == "a");
-		CHECK(grid.reverseTopDownDiagonal(1).toString() == "b");
-		CHECK(grid.reverseTopDownDiagonal(2).toString() == "c");
-		CHECK(grid.reverseTopDownDiagonal(3).toString() == "d");
+		AOC_ENFORCE(position == aoc::Point2uz(9999, 9999));
+	});
 
-		const vector<string> lines4 =
-		{
-			"abcdefgh",
-		};
+	const double findAnyCellSeconds = measureBestSeconds([&]()
+	{
+		AOC_ENFORCE(grid.findAnyCell({ '^', '>', 'v', '<' }) == aoc::Point2uz(9999, 9999));
+	});
+
+	println("grid scanning ({}x{} grid)", grid.width(), grid.height());
+	printThroughput("  count, scalar loop (before)", grid.numCells(), scalarCountSeconds);
+	printThroughput("  count", grid.numCells(), countSeconds);
+	printThroughput("  find guard, findCell per char (before)", grid.numCells(), scalarFindSeconds);
+	printThroughput("  find guard, findAnyCell", grid.numCells(), findAnyCellSeconds);
+}
 
-		grid.reset(lines4);
+void benchmarkFloodFill()
+{
+	constexpr size_t gridSize = 4000;
 
-		CHECK(grid.reverseTopDownDiagonal(0).toString() == "a");
-		CHECK(grid.reverseTopDownDiagonal(1).toString() == "b");
-		CHECK(grid.reverseTopDownDiagonal(2).toString() == "c");
-		CHECK(grid.reverseTopDownDiagonal(3).toString() == "d");
-		CHECK(grid.reverseTopDownDiagonal(4).toString() == "e");
-		CHECK(grid.reverseTopDownDiagonal(5).toString() == "f");
-		CHECK(grid.reverseTopDownDiagonal(6).toString() == "g");
-		CHECK(grid.reverseTopDownDiagonal(7).toString() == "h");
+	aoc::BoundedGrid2D<char> grid(gridSize, gridSize, '.');
+
+	uint64_t state = 0x9e3779b97f4a7c15;
+
+	for(size_t i=0; i<grid.numCells(); ++i)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+
+		if(state % 10 < 3)
+			grid.data()[i] = '#';
 	}
 
-	SUBCASE("constReverseTopDownDiagonal")
+	grid.setCell(gridSize / 2, gridSize / 2, '.');
+
+	size_t expectedNumReached = 0;
+
+	const double boundsCheckedSeconds = measureBestSeconds([&]()
 	{
-		const vector<string> lines1 =
-		{
-			"abcde",
-			"fghij",
-			"klmno",
-		};
+		vector<uint8_t> visited(grid.numCells(), 0);
+		vector<aoc::Point2uz> stack = { aoc::Point2uz(gridSize / 2, gridSize / 2) };
 
-		aoc::BoundedGrid2D<char> grid(lines1);
+		visited[stack.back().y_ * gridSize + stack.back().x_] = 1;
 
-		CHECK(grid.constReverseTopDownDiagonal(0).toString() == "k");
-		CHECK(grid.constReverseTopDownDiagonal(1).toString() == "lf");
-		CHECK(grid.constReverseTopDownDiagonal(2).toString() == "mga");
-		CHECK(grid.constReverseTopDownDiagonal(3).toString() == "nhb");
-		CHECK(grid.constReverseTopDownDiagonal(4).toString() == "oic");
-		CHECK(grid.constReverseTopDownDiagonal(5).toString() == "jd");
-		CHECK(grid.constReverseTopDownDiagonal(6).toString() == "e");
+		size_t numReached = 0;
 
-		const vector<string> lines2 =
+		auto visit = [&](size_t x, size_t y)
 		{
-			"abcd",
-			"efgh",
-			"ijkl",
-			"mnop",
+			if(grid.cell(x, y) == '.' && !visited[y * gridSize + x])
+			{
+				visited[y * gridSize + x] = 1;
+				stack.emplace_back(x, y);
+			}
 		};
 
-		grid.reset(lines2);
+		while(!stack.empty())
+		{
+			const aoc::Point2uz pos = stack.back();
 
-		CHECK(grid.constReverseTopDownDiagonal(0).toString() == "m");
-		CHECK(grid.constReverseTopDownDiagonal(1).toString() == "ni");
-		CHECK(grid.constReverseTopDownDiagonal(2).toString() == "oje");
-		CHECK(grid.constReverseTopDownDiagonal(3).toString() == "pkfa");
-		CHECK(grid.constReverseTopDownDiagonal(4).toString() == "lgb");
-		CHECK(grid.constReverseTopDownDiagonal(5).toString() == "hc");
-		CHECK(grid.constReverseTopDownDiagonal(6).toString() == "d");
+			stack.pop_back();
+			++numReached;
 
-		const vector<string> lines3 =
-		{
-			"abcd",
-		};
+			if(pos.y_ > 0           ) visit(pos.x_, pos.y_-1);
+			if(pos.y_ < gridSize - 1) visit(pos.x_, pos.y_+1);
+			if(pos.x_ > 0           ) visit(pos.x_-1, pos.y_);
+			if(pos.x_ < gridSize - 1) visit(pos.x_+1, pos.y_);
+		}
 
-		grid.reset(lines3);
+		expectedNumReached = numReached;
+	});
 
-		CHECK(grid.constReverseTopDownDiagonal(0).toString() == "a");
-		CHECK(grid.constReverseTopDownDiagonal(1).toString() == "b");
-		CHECK(grid.constReverseTopDownDiagonal(2).toString() == "c");
-		CHECK(grid.constReverseTopDownDiagonal(3).toString() == "d");
+	const aoc::PaddedGrid2D<char> paddedGrid(grid, 1, '#');
 
-		const vector<string> lines4 =
+	const double paddedSeconds = measureBestSeconds([&]()
+	{
+		vector<uint8_t> visited(paddedGrid.size(), 0);
+		vector<size_t> stack = { paddedGrid.index(gridSize / 2, gridSize / 2) };
+
+		visited[stack.back()] = 1;
+
+		size_t numReached = 0;
+
+		const auto offsets = paddedGrid.adjacentOffsets();
+
+		while(!stack.empty())
 		{
-			"abcdefgh",
-		};
+			const size_t index = stack.back();
 
-		grid.reset(lines4);
+			stack.pop_back();
+			++numReached;
 
-		CHECK(grid.constReverseTopDownDiagonal(0).toString() == "a");
-		CHECK(grid.constReverseTopDownDiagonal(1).toString() == "b");
-		CHECK(grid.constReverseTopDownDiagonal(2).toString() == "c");
-		CHECK(grid.constReverseTopDownDiagonal(3).toString() == "d");
-		CHECK(grid.constReverseTopDownDiagonal(4).toString() == "e");
-		CHECK(grid.constReverseTopDownDiagonal(5).toString() == "f");
-		CHECK(grid.constReverseTopDownDiagonal(6).toString() == "g");
-		CHECK(grid.constReverseTopDownDiagonal(7).toString() == "h");
-	}
+			for(ptrdiff_t offset : offsets)
+			{
+				const size_t neighbor = index + offset;
 
-	SUBCASE("bottomUpDiagonal")
+				if(paddedGrid[neighbor] == '.' && !visited[neighbor])
+				{
+					visited[neighbor] = 1;
+					stack.push_back(neighbor);
+				}
+			}
+		}
+
+		AOC_ENFORCE(numReached == expectedNumReached);
+	});
+
+	auto isOpen = [&](const aoc::Point2uz& pos) { return grid.cell(pos) == '.'; };
+
+	aoc::GridTraversal traversal(gridSize, gridSize);
+
+	const double traversalSeconds = measureBestSeconds([&]()
 	{
-		const vector<string> lines1 =
-		{
-			"abcde",
-			"fghij",
-			"klmno",
-		};
+		const size_t numReached = traversal.floodFill(aoc::Point2uz(gridSize / 2, gridSize / 2), isOpen, [](const aoc::Point2uz&) {});
 
-		aoc::BoundedGrid2D<char> grid(lines1);
+		AOC_ENFORCE(numReached == expectedNumReached);
+	});
 
-		CHECK(grid.bottomUpDiagonal(0).toString() == "a");
-		CHECK(grid.bottomUpDiagonal(1).toString() == "fb");
-		CHECK(grid.bottomUpDiagonal(2).toString() == "kgc");
-		CHECK(grid.bottomUpDiagonal(3).toString() == "lhd");
-		CHECK(grid.bottomUpDiagonal(4).toString() == "mie");
-		CHECK(grid.bottomUpDiagonal(5).toString() == "nj");
-		CHECK(grid.bottomUpDiagonal(6).toString() == "o");
+	println("flood fill ({}x{} grid, {} cells reached)", gridSize, gridSize, expectedNumReached);
+	printCostPerItem("  BoundedGrid2D, bounds checks (before)", expectedNumReached, "cell", boundsCheckedSeconds);
+	printCostPerItem("  PaddedGrid2D, sentinel border", expectedNumReached, "cell", paddedSeconds);
+	printCostPerItem("  GridTraversal, reused buffers", expectedNumReached, "cell", traversalSeconds);
 
-		const vector<string> lines2 =
-		{
-			"abcd",
-			"efgh",
-			"ijkl",
-			"mnop",
-		};
+	// The traversal buffers of a 10k x 10k grid are allocated once and then
+	// reused by every flood fill.
+	constexpr size_t largeGridSize = 10000;
 
-		grid.reset(lines2);
+	aoc::GridTraversal largeTraversal(largeGridSize, largeGridSize);
 
-		CHECK(grid.bottomUpDiagonal(0).toString() == "a");
-		CHECK(grid.bottomUpDiagonal(1).toString() == "eb");
-		CHECK(grid.bottomUpDiagonal(2).toString() == "ifc");
-		CHECK(grid.bottomUpDiagonal(3).toString() == "mjgd");
-		CHECK(grid.bottomUpDiagonal(4).toString() == "nkh");
-		CHECK(grid.bottomUpDiagonal(5).toString() == "ol");
-		CHECK(grid.bottomUpDiagonal(6).toString() == "p");
+	// Walls every 7 columns, with a gap every 11 rows.
+	auto isLargeGridOpen = [](const aoc::Point2uz& pos) { return pos.x_ % 7 != 3 || pos.y_ % 11 == 0; };
 
-		const vector<string> lines3 =
-		{
-			"abcd",
-		};
+	size_t numLargeGridCellsReached = 0;
 
-		grid.reset(lines3);
+	const double largeGridSeconds = measureBestSeconds([&]()
+	{
+		numLargeGridCellsReached = largeTraversal.floodFill(aoc::Point2uz(0, 0), isLargeGridOpen, [](const aoc::Point2uz&) {});
+	}, 3);
 
-		CHECK(grid.bottomUpDiagonal(0).toString() == "a");
-		CHECK(grid.bottomUpDiagonal(1).toString() == "b");
-		CHECK(grid.bottomUpDiagonal(2).toString() == "c");
-		CHECK(grid.bottomUpDiagonal(3).toString() == "d");
+	println("flood fill ({}x{} grid, {} cells reached)", largeGridSize, largeGridSize, numLargeGridCellsReached);
+	printCostPerItem("  GridTraversal, reused buffers", numLargeGridCellsReached, "cell", largeGridSeconds);
+}
 
-		const vector<string> lines4 =
-		{
-			"abcdefgh",
-		};
+void benchmarkUnboundedWalk()
+{
+	constexpr size_t numSteps = 4000000;
 
-		grid.reset(lines4);
+	// A walk that keeps turning back on itself, so that most locations are
+	// visited several times.
+	vector<aoc::Direction> steps(numSteps);
 
-		CHECK(grid.bottomUpDiagonal(0).toString() == "a");
-		CHECK(grid.bottomUpDiagonal(1).toString() == "b");
-		CHECK(grid.bottomUpDiagonal(2).toString() == "c");
-		CHECK(grid.bottomUpDiagonal(3).toString() == "d");
-		CHECK(grid.bottomUpDiagonal(4).toString() == "e");
-		CHECK(grid.bottomUpDiagonal(5).toString() == "f");
-		CHECK(grid.bottomUpDiagonal(6).toString() == "g");
-		CHECK(grid.bottomUpDiagonal(7).toString() == "h");
+	uint64_t state = 0x9e3779b97f4a7c15;
+
+	for(auto& step : steps)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+
+		step = static_cast<aoc::Direction>(state % 4);
 	}
 
-	SUBCASE("constBottomUpDiagonal")
+	size_t expectedNumRevisits = 0;
+	size_t numLocations = 0;
+
+	const double setSeconds = measureBestSeconds([&]()
 	{
-		const vector<string> lines1 =
+		set<tuple<int, int>> visited = { make_tuple(0, 0) };
+
+		aoc::Point2i position;
+		size_t numRevisits = 0;
+
+		for(aoc::Direction step : steps)
 		{
-			"abcde",
-			"fghij",
-			"klmno",
-		};
+			position = aoc::nextPosition(position, step);
 
-		aoc::BoundedGrid2D<char> grid(lines1);
+			if(!visited.insert(make_tuple(position.x_, position.y_)).second)
+				++numRevisits;
+		}
 
-		CHECK(grid.constBottomUpDiagonal(0).toString() == "a");
-		CHECK(grid.constBottomUpDiagonal(1).toString() == "fb");
-		CHECK(grid.constBottomUpDiagonal(2).toString() == "kgc");
-		CHECK(grid.constBottomUpDiagonal(3).toString() == "lhd");
-		CHECK(grid.constBottomUpDiagonal(4).toString() == "mie");
-		CHECK(grid.constBottomUpDiagonal(5).toString() == "nj");
-		CHECK(grid.constBottomUpDiagonal(6).toString() == "o");
+		expectedNumRevisits = numRevisits;
+		numLocations = visited.size();
+	}, 1);
 
-		const vector<string> lines2 =
-		{
-			"abcd",
-			"efgh",
-			"ijkl",
-			"mnop",
-		};
+	size_t numAllocatedCells = 0;
 
-		grid.reset(lines2);
+	const double unboundedGridSeconds = measureBestSeconds([&]()
+	{
+		aoc::UnboundedGrid2D<bool> visited;
 
-		CHECK(grid.constBottomUpDiagonal(0).toString() == "a");
-		CHECK(grid.constBottomUpDiagonal(1).toString() == "eb");
-		CHECK(grid.constBottomUpDiagonal(2).toString() == "ifc");
-		CHECK(grid.constBottomUpDiagonal(3).toString() == "mjgd");
-		CHECK(grid.constBottomUpDiagonal(4).toString() == "nkh");
-		CHECK(grid.constBottomUpDiagonal(5).toString() == "ol");
-		CHECK(grid.constBottomUpDiagonal(6).toString() == "p");
+		aoc::Point2i position;
+		size_t numRevisits = 0;
 
-		const vector<string> lines3 =
+		visited.setCell(position, true);
+
+		for(aoc::Direction step : steps)
 		{
-			"abcd",
-		};
+			position = aoc::nextPosition(position, step);
 
-		grid.reset(lines3);
+			if(visited.testAndSetCell(position))
+				++numRevisits;
+		}
 
-		CHECK(grid.constBottomUpDiagonal(0).toString() == "a");
-		CHECK(grid.constBottomUpDiagonal(1).toString() == "b");
-		CHECK(grid.constBottomUpDiagonal(2).toString() == "c");
-		CHECK(grid.constBottomUpDiagonal(3).toString() == "d");
+		AOC_ENFORCE(numRevisits == expectedNumRevisits);
 
-		const vector<string> lines4 =
-		{
-			"abcdefgh",
-		};
+		numAllocatedCells = visited.numAllocatedCells();
+	}, 3);
 
-		grid.reset(lines4);
+	// A std::set node holds three pointers, the color and the key.
+	const size_t setNodeBytes = 3 * sizeof(void*) + sizeof(int) + sizeof(tuple<int, int>);
 
-		CHECK(grid.constBottomUpDiagonal(0).toString() == "a");
-		CHECK(grid.constBottomUpDiagonal(1).toString() == "b");
-		CHECK(grid.constBottomUpDiagonal(2).toString() == "c");
-		CHECK(grid.constBottomUpDiagonal(3).toString() == "d");
-		CHECK(grid.constBottomUpDiagonal(4).toString() == "e");
-		CHECK(grid.constBottomUpDiagonal(5).toString() == "f");
-		CHECK(grid.constBottomUpDiagonal(6).toString() == "g");
-		CHECK(grid.constBottomUpDiagonal(7).toString() == "h");
-	}
+	println("unbounded walk ({} steps, {} locations)", numSteps, numLocations);
+	printCostPerItem("  set<tuple<int, int>> (before)", numSteps, "step", setSeconds);
+	printCostPerItem("  UnboundedGrid2D<bool>", numSteps, "step", unboundedGridSeconds);
+	println("  memory: set about {} MB, UnboundedGrid2D {} MB", (numLocations * setNodeBytes) >> 20, numAllocatedCells >> 20);
+}
 
-	SUBCASE("reverseBottomUpDiagonal")
+// Dijkstra with a binary heap over the states of pathFinder, for comparison.
+template<class StepCost>
+aoc::GridPathFinder::Cost binaryHeapDijkstra(size_t width, size_t height, bool isDirected, aoc::GridPathFinder::Cost turnCost,
+                                             const aoc::Point2uz& start, const aoc::Point2uz& goal, StepCost stepCost)
+{
+	typedef aoc::GridPathFinder::Cost Cost;
+	typedef pair<Cost, uint32_t> Item;
+
+	const size_t numDirections = isDirected ? 4 : 1;
+
+	vector<Cost> distances(width * height * numDirections, aoc::GridPathFinder::unreachable);
+	priority_queue<Item, vector<Item>, greater<Item>> queue;
+
+	auto relax = [&](size_t x, size_t y, aoc::Direction facing, Cost cost)
 	{
-		const vector<string> lines1 =
+		const uint32_t state = static_cast<uint32_t>((y * width + x) * numDirections + (isDirected ? static_cast<size_t>(facing) : 0));
+
+		if(cost < distances[state])
 		{
-			"abcde",
-			"fghij",
-			"klmno",
-		};
+			distances[state] = cost;
+			queue.emplace(cost, state);
+		}
+	};
 
-		aoc::BoundedGrid2D<char> grid(lines1);
+	relax(start.x_, start.y_, aoc::Direction::East, 0);
 
-		CHECK(grid.reverseBottomUpDiagonal(0).toString() == "a");
-		CHECK(grid.reverseBottomUpDiagonal(1).toString() == "bf");
-		CHECK(grid.reverseBottomUpDiagonal(2).toString() == "cgk");
-		CHECK(grid.reverseBottomUpDiagonal(3).toString() == "dhl");
-		CHECK(grid.reverseBottomUpDiagonal(4).toString() == "eim");
-		CHECK(grid.reverseBottomUpDiagonal(5).toString() == "jn");
-		CHECK(grid.reverseBottomUpDiagonal(6).toString() == "o");
+	while(!queue.empty())
+	{
+		const auto [cost, state] = queue.top();
 
-		const vector<string> lines2 =
+		queue.pop();
+
+		if(cost != distances[state])
+			continue;
+
+		const aoc::Point2uz pos((state / numDirections) % width, (state / numDirections) / width);
+
+		if(pos == goal)
+			return cost;
+
+		auto step = [&](aoc::Direction direction)
 		{
-			"abcd",
-			"efgh",
-			"ijkl",
-			"mnop",
-		};
+			const aoc::Point2i to = aoc::nextPosition(aoc::Point2i(pos), direction);
 
-		grid.reset(lines2);
+			if(to.x_ < 0 || to.y_ < 0 || size_t(to.x_) >= width || size_t(to.y_) >= height)
+				return;
 
-		CHECK(grid.reverseBottomUpDiagonal(0).toString() == "a");
-		CHECK(grid.reverseBottomUpDiagonal(1).toString() == "be");
-		CHECK(grid.reverseBottomUpDiagonal(2).toString() == "cfi");
-		CHECK(grid.reverseBottomUpDiagonal(3).toString() == "dgjm");
-		CHECK(grid.reverseBottomUpDiagonal(4).toString() == "hkn");
-		CHECK(grid.reverseBottomUpDiagonal(5).toString() == "lo");
-		CHECK(grid.reverseBottomUpDiagonal(6).toString() == "p");
+			const Cost toCost = stepCost(pos, aoc::Point2uz(to));
+
+			if(toCost != aoc::GridPathFinder::noStep)
+				relax(to.x_, to.y_, direction, cost + toCost);
+		};
+
+		if(isDirected)
+		{
+			const aoc::Direction facing = static_cast<aoc::Direction>(state % numDirections);
 
-		const vector<string> lines3 =
+			step(facing);
+			relax(pos.x_, pos.y_, aoc::turnLeft(facing), cost + turnCost);
+			relax(pos.x_, pos.y_, aoc::turnRight(facing), cost + turnCost);
+		}
+		else
 		{
-			"abcd",
-		};
+			step(aoc::Direction::North);
+			step(aoc::Direction::West);
+			step(aoc::Direction::East);
+			step(aoc::Direction::South);
+		}
+	}
 
-		grid.reset(lines3);
+	return aoc::GridPathFinder::unreachable;
+}
 
-		CHECK(grid.reverseBottomUpDiagonal(0).toString() == "a");
-		CHECK(grid.reverseBottomUpDiagonal(1).toString() == "b");
-		CHECK(grid.reverseBottomUpDiagonal(2).toString() == "c");
-		CHECK(grid.reverseBottomUpDiagonal(3).toString() == "d");
+void benchmarkShortestPaths()
+{
+	typedef aoc::GridPathFinder::Cost Cost;
 
-		const vector<string> lines4 =
-		{
-			"abcdefgh",
-		};
+	constexpr size_t gridSize = 4000;
 
-		grid.reset(lines4);
+	// A maze of random walls in which the cost of a step is the digit of the
+	// cell stepped onto.
+	aoc::BoundedGrid2D<char> maze(gridSize, gridSize);
 
-		CHECK(grid.reverseBottomUpDiagonal(0).toString() == "a");
-		CHECK(grid.reverseBottomUpDiagonal(1).toString() == "b");
-		CHECK(grid.reverseBottomUpDiagonal(2).toString() == "c");
-		CHECK(grid.reverseBottomUpDiagonal(3).toString() == "d");
-		CHECK(grid.reverseBottomUpDiagonal(4).toString() == "e");
-		CHECK(grid.reverseBottomUpDiagonal(5).toString() == "f");
-		CHECK(grid.reverseBottomUpDiagonal(6).toString() == "g");
-		CHECK(grid.reverseBottomUpDiagonal(7).toString() == "h");
+	uint64_t state = 0x9e3779b97f4a7c15;
+
+	for(size_t i=0; i<maze.numCells(); ++i)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+
+		maze.data()[i] = (state % 10 < 3) ? '#' : static_cast<char>('1' + state % 9);
 	}
 
-	SUBCASE("constReverseBottomUpDiagonal")
+	const aoc::Point2uz start(0, 0);
+	const aoc::Point2uz goal(gridSize - 1, gridSize - 1);
+
+	maze.setCell(start, '1');
+	maze.setCell(goal, '1');
+
+	auto weightedStepCost = [&](const aoc::Point2uz&, const aoc::Point2uz& to) -> Cost
 	{
-		const vector<string> lines1 =
-		{
-			"abcde",
-			"fghij",
-			"klmno",
-		};
+		return (maze.cell(to) == '#') ? aoc::GridPathFinder::noStep : maze.cell(to) - '0';
+	};
 
-		aoc::BoundedGrid2D<char> grid(lines1);
+	auto unitStepCost = [&](const aoc::Point2uz&, const aoc::Point2uz& to) -> Cost
+	{
+		return (maze.cell(to) == '#') ? aoc::GridPathFinder::noStep : 1;
+	};
 
-		CHECK(grid.constReverseBottomUpDiagonal(0).toString() == "a");
-		CHECK(grid.constReverseBottomUpDiagonal(1).toString() == "bf");
-		CHECK(grid.constReverseBottomUpDiagonal(2).toString() == "cgk");
-		CHECK(grid.constReverseBottomUpDiagonal(3).toString() == "dhl");
-		CHECK(grid.constReverseBottomUpDiagonal(4).toString() == "eim");
-		CHECK(grid.constReverseBottomUpDiagonal(5).toString() == "jn");
-		CHECK(grid.constReverseBottomUpDiagonal(6).toString() == "o");
+	auto benchmark = [&](const char* name, bool isDirected, Cost maxStepCost, Cost turnCost, auto stepCost)
+	{
+		Cost expectedCost = 0;
 
-		const vector<string> lines2 =
+		const double binaryHeapSeconds = measureBestSeconds([&]()
 		{
-			"abcd",
-			"efgh",
-			"ijkl",
-			"mnop",
-		};
+			expectedCost = binaryHeapDijkstra(gridSize, gridSize, isDirected, turnCost, start, goal, stepCost);
+		}, 1);
 
-		grid.reset(lines2);
+		aoc::GridPathFinder pathFinder(gridSize, gridSize, maxStepCost, isDirected, turnCost);
 
-		CHECK(grid.constReverseBottomUpDiagonal(0).toString() == "a");
-		CHECK(grid.constReverseBottomUpDiagonal(1).toString() == "be");
-		CHECK(grid.constReverseBottomUpDiagonal(2).toString() == "cfi");
-		CHECK(grid.constReverseBottomUpDiagonal(3).toString() == "dgjm");
-		CHECK(grid.constReverseBottomUpDiagonal(4).toString() == "hkn");
-		CHECK(grid.constReverseBottomUpDiagonal(5).toString() == "lo");
-		CHECK(grid.constReverseBottomUpDiagonal(6).toString() == "p");
+		const double dijkstraSeconds = measureBestSeconds([&]()
+		{
+			AOC_ENFORCE(pathFinder.dijkstra(start, goal, stepCost) == expectedCost);
+		}, 3);
 
-		const vector<string> lines3 =
+		const double aStarSeconds = measureBestSeconds([&]()
 		{
-			"abcd",
-		};
+			AOC_ENFORCE(pathFinder.aStar(start, goal, stepCost) == expectedCost);
+		}, 3);
 
-		grid.reset(lines3);
+		const size_t numStates = maze.numCells() * (isDirected ? 4 : 1);
 
-		CHECK(grid.constReverseBottomUpDiagonal(0).toString() == "a");
-		CHECK(grid.constReverseBottomUpDiagonal(1).toString() == "b");
-		CHECK(grid.constReverseBottomUpDiagonal(2).toString() == "c");
-		CHECK(grid.constReverseBottomUpDiagonal(3).toString() == "d");
+		println("shortest path, {} ({}x{} maze, cost {})", name, gridSize, gridSize, expectedCost);
+		printCostPerItem("  Dijkstra, binary heap (before)", numStates, "state", binaryHeapSeconds);
+		printCostPerItem("  Dijkstra, bucket queue", numStates, "state", dijkstraSeconds);
+		printCostPerItem("  A*, bucket queue", numStates, "state", aStarSeconds);
+	};
 
-		const vector<string> lines4 =
-		{
-			"abcdefgh",
-		};
+	benchmark("step costs 1-9", false, 9, 0, weightedStepCost);
+	benchmark("turn cost 1000", true, 1, 1000, unitStepCost);
+}
 
-		grid.reset(lines4);
+void benchmarkCellularAutomaton()
+{
+	constexpr size_t gridSize = 4096;
+	constexpr size_t numGenerations = 4;
 
-		CHECK(grid.constReverseBottomUpDiagonal(0).toString() == "a");
-		CHECK(grid.constReverseBottomUpDiagonal(1).toString() == "b");
-		CHECK(grid.constReverseBottomUpDiagonal(2).toString() == "c");
-		CHECK(grid.constReverseBottomUpDiagonal(3).toString() == "d");
-		CHECK(grid.constReverseBottomUpDiagonal(4).toString() == "e");
-		CHECK(grid.constReverseBottomUpDiagonal(5).toString() == "f");
-		CHECK(grid.constReverseBottomUpDiagonal(6).toString() == "g");
-		CHECK(grid.constReverseBottomUpDiagonal(7).toString() == "h");
+	aoc::BoundedGrid2D<char> grid(gridSize, gridSize, '.');
+
+	uint64_t state = 0x9e3779b97f4a7c15;
+
+	for(size_t i=0; i<grid.numCells(); ++i)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+
+		if(state % 3 == 0)
+			grid.data()[i] = '#';
 	}
 
-	SUBCASE("adjacentNeighbors")
+	size_t expectedNumAlive = 0;
+
+	// Copies the grid every generation and checks the bounds of every
+	// neighbor.
+	const double handRolledSeconds = measureBestSeconds([&]()
 	{
-		const vector<string> lines1 =
+		aoc::BoundedGrid2D<char> cells = grid;
+
+		for(size_t generation=0; generation<numGenerations; ++generation)
 		{
-			"abcde",
-			"fghij",
-			"klmno",
-		};
+			const aoc::BoundedGrid2D<char> previousCells = cells;
+
+			for(size_t y=0; y<gridSize; ++y)
+			{
+				for(size_t x=0; x<gridSize; ++x)
+				{
+					size_t numAlive = 0;
+
+					for(int dy=-1; dy<=1; ++dy)
+					{
+						for(int dx=-1; dx<=1; ++dx)
+						{
+							const int nx = int(x) + dx;
+							const int ny = int(y) + dy;
+
+							if((dx != 0 || dy != 0) && nx >= 0 && ny >= 0 && nx < int(gridSize) && ny < int(gridSize) && previousCells.cell(nx, ny) == '#')
+								++numAlive;
+						}
+					}
+
+					cells.setCell(x, y, (numAlive == 3 || (numAlive == 2 && previousCells.cell(x, y) == '#')) ? '#' : '.');
+				}
+			}
+		}
+
+		expectedNumAlive = cells.count('#');
+	}, 1);
+
+	auto conwayRule = [](const aoc::CellularAutomaton::Neighborhood& neighborhood)
+	{
+		const size_t numAlive = neighborhood.count('#');
 
-		aoc::BoundedGrid2D<char> grid(lines1);
+		return (numAlive == 3 || (numAlive == 2 && neighborhood.cell() == '#')) ? '#' : '.';
+	};
 
-		CHECK(grid.adjacentNeighbors(0, 0).toString() == "bf");
-		CHECK(grid.adjacentNeighbors(0, 1).toString() == "agk");
-		CHECK(grid.adjacentNeighbors(0, 2).toString() == "fl");
+	aoc::CellularAutomaton automaton(grid);
 
-		CHECK(grid.adjacentNeighbors(2, 0).toString() == "bdh");
-		CHECK(grid.adjacentNeighbors(2, 1).toString() == "cgim");
-		CHECK(grid.adjacentNeighbors(2, 2).toString() == "hln");
+	const double ruleSeconds = measureBestSeconds([&]()
+	{
+		automaton.reset(grid);
+		automaton.step(conwayRule, numGenerations);
 
-		CHECK(grid.adjacentNeighbors(4, 0).toString() == "dj");
-		CHECK(grid.adjacentNeighbors(4, 1).toString() == "eio");
-		CHECK(grid.adjacentNeighbors(4, 2).toString() == "jn");
-	}
-}
+		AOC_ENFORCE(automaton.count('#') == expectedNumAlive);
+	}, 3);
 
-TEST_CASE("MathUtils")
-{
-	SUBCASE("isInRange")
+	const double lifeLikeRuleSeconds = measureBestSeconds([&]()
 	{
-		CHECK(aoc::MathUtils::isInRange(1, 1, 10) == true);
-		CHECK(aoc::MathUtils::isInRange(5, 1, 10) == true);
-		CHECK(aoc::MathUtils::isInRange(10, 1, 10) == true);
-		CHECK(aoc::MathUtils::isInRange(0, 1, 10) == false);
-		CHECK(aoc::MathUtils::isInRange(11, 1, 10) == false);
-		CHECK(aoc::MathUtils::isInRange(-10, 1, 10) == false);
-		CHECK(aoc::MathUtils::isInRange(20, 1, 10) == false);
-		CHECK(aoc::MathUtils::isInRange(3, -1, 3) == true);
-	}
+		automaton.reset(grid);
+		automaton.step(aoc::CellularAutomaton::LifeLikeRule(), numGenerations);
 
-	SUBCASE("manhattanDistance")
-	{
-		CHECK(aoc::MathUtils::manhattanDistance(0, 0, 0, 0) == 0);
-		CHECK(aoc::MathUtils::manhattanDistance(0, 0, 1, 0) == 1);
-		CHECK(aoc::MathUtils::manhattanDistance(0, 0, 0, 1) == 1);
-		CHECK(aoc::MathUtils::manhattanDistance(0, 0, 1, 1) == 2);
-		CHECK(aoc::MathUtils::manhattanDistance(1, 6, -1, 5) == 3);
-		CHECK(aoc::MathUtils::manhattanDistance(3, 5, -1, 5) == 4);
-		CHECK(aoc::MathUtils::manhattanDistance(2, 3, -1, 5) == 5);
-		CHECK(aoc::MathUtils::manhattanDistance(-6, 0, 0, 0) == 6);
-		CHECK(aoc::MathUtils::manhattanDistance(1, 1, 4, 5) == 7);
-	}
+		AOC_ENFORCE(automaton.count('#') == expectedNumAlive);
+	}, 3);
+
+	const size_t numCellUpdates = grid.numCells() * numGenerations;
+
+	println("cellular automaton ({}x{} grid, {} generations, {} threads)", gridSize, gridSize, numGenerations, thread::hardware_concurrency());
+	printItemsPerSecond("  hand-rolled, grid copies (before)", numCellUpdates, "cell", handRolledSeconds);
+	printItemsPerSecond("  CellularAutomaton, rule", numCellUpdates, "cell", ruleSeconds);
+	printItemsPerSecond("  CellularAutomaton, LifeLikeRule", numCellUpdates, "cell", lifeLikeRuleSeconds);
 }
 
-TEST_CASE("StringUtils")
+template<class Layout>
+void benchmarkGridLayout(const char* name, const vector<uint8_t>& isWall, size_t gridSize)
 {
-	SUBCASE("contains(const string& str, const string& substr)")
-	{
-		CHECK(aoc::StringUtils::contains("abc", "a"));
-		CHECK(aoc::StringUtils::contains("abc", "b"));
-		CHECK(aoc::StringUtils::contains("abc", "c"));
-		CHECK(aoc::StringUtils::contains("abc", "ab"));
-		CHECK(aoc::StringUtils::contains("abc", "bc"));
-		CHECK(aoc::StringUtils::contains("abc", "abc"));
-		CHECK(!aoc::StringUtils::contains("abc", "x"));
-		CHECK(!aoc::StringUtils::contains("abc", "ac"));
-		CHECK(!aoc::StringUtils::contains("abc", "acb"));
-	}
+	aoc::BoundedGrid2D<uint8_t, Layout> grid(gridSize, gridSize);
 
-	SUBCASE("contains(const string& str, char ch)")
-	{
-		CHECK(aoc::StringUtils::contains("abc", 'a'));
-		CHECK(aoc::StringUtils::contains("abc", 'b'));
-		CHECK(aoc::StringUtils::contains("abc", 'c'));
-		CHECK(!aoc::StringUtils::contains("abc", 'x'));
-	}
+	for(size_t y=0; y<gridSize; ++y)
+		for(size_t x=0; x<gridSize; ++x)
+			grid.setCell(x, y, isWall[y * gridSize + x]);
 
-	SUBCASE("countOverlappingSubstrings")
+	size_t checksum = 0;
+
+	const double columnsSeconds = measureBestSeconds([&]()
 	{
-		CHECK(aoc::StringUtils::countOverlappingSubstrings("", "a") == 0);
-		CHECK(aoc::StringUtils::countOverlappingSubstrings("a", "a") == 1);
-		CHECK(aoc::StringUtils::countOverlappingSubstrings("aa", "a") == 2);
-		CHECK(aoc::StringUtils::countOverlappingSubstrings("aaa", "a") == 3);
-		CHECK(aoc::StringUtils::countOverlappingSubstrings("a", "aa") == 0);
+		size_t numWalls = 0;
 
-		CHECK(aoc::StringUtils::countOverlappingSubstrings("", "bb") == 0);
-		CHECK(aoc::StringUtils::countOverlappingSubstrings("bb", "bb") == 1);
-		CHECK(aoc::StringUtils::countOverlappingSubstrings("bbb", "bb") == 2);
-		CHECK(aoc::StringUtils::countOverlappingSubstrings("bbbb", "bb") == 3);
-		CHECK(aoc::StringUtils::countOverlappingSubstrings("bb", "bbb") == 0);
+		for(size_t x=0; x<gridSize; ++x)
+			for(size_t y=0; y<gridSize; ++y)
+				numWalls += grid.cell(x, y);
 
-		CHECK(aoc::StringUtils::countOverlappingSubstrings("aaabbaaa", "aa") == 4);
-	}
+		checksum += numWalls;
+	}, 1);
 
-	SUBCASE("countNonOverlappingSubstrings")
+	const double diagonalsSeconds = measureBestSeconds([&]()
 	{
-		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("", "a") == 0);
-		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("a", "a") == 1);
-		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("aa", "a") == 2);
-		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("aaa", "a") == 3);
-		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("a", "aa") == 0);
+		size_t numWalls = 0;
 
-		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("", "bb") == 0);
-		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("bb", "bb") == 1);
-		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("bbb", "bb") == 1);
-		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("bbbb", "bb") == 2);
-		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("bb", "bbb") == 0);
+		for(size_t i=0; i<grid.numDiagonals(); ++i)
+		{
+			const auto diagonal = grid.constTopDownDiagonal(i);
 
-		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("aaabbaaa", "aa") == 2);
-		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("aaaaaaa", "aa") == 3);
-		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("aaaaaaaa", "aa") == 4);
-		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("aaaaaaaaa", "aa") == 4);
+			for(size_t k=0; k<diagonal.length(); ++k)
+				numWalls += diagonal[k];
+		}
 
-		CHECK(aoc::StringUtils::countNonOverlappingSubstrings("MMMSXXMASM", "XMAS") == 1);
-	}
+		checksum += numWalls;
+	}, 1);
 
-	SUBCASE("replaceAll")
+	const double bfsSeconds = measureBestSeconds([&]()
 	{
-		CHECK(aoc::StringUtils::replaceAll("one", "one", "1") == "1");
-		CHECK(aoc::StringUtils::replaceAll("twotwo", "two", "2") == "22");
-		CHECK(aoc::StringUtils::replaceAll("twoonetwo", "two", "2") == "2one2");
-		CHECK(aoc::StringUtils::replaceAll("one two three three", "three", "3") == "one two 3 3");
-		CHECK(aoc::StringUtils::replaceAll("one twoone three one one threeoneone", "one", "1") == "1 two1 three 1 1 three11");
-		CHECK(aoc::StringUtils::replaceAll("two1nine", "two", "2") == "21nine");
-	}
+		aoc::BoundedGrid2D<uint8_t, Layout> visited(gridSize, gridSize);
+		vector<aoc::Point2uz> queue = { aoc::Point2uz(gridSize / 2, gridSize / 2) };
 
-	SUBCASE("tokenize")
-	{
-		CHECK(aoc::StringUtils::tokenize("15 red, 1 green, 3 blue") == vector<string>({ "15 red", "1 green", "3 blue"}));
-		CHECK(aoc::StringUtils::tokenize("7  15   30", ' ', true, true) == vector<string>({ "7", "15", "30"}));
-	}
+		visited.setCell(queue.front(), 1);
 
-	SUBCASE("trim(str)")
-	{
-		CHECK(aoc::StringUtils::trim(" test ") == "test");
-	}
+		for(size_t head=0; head<queue.size(); ++head)
+		{
+			const aoc::Point2uz pos = queue[head];
+
+			auto visit = [&](size_t x, size_t y)
+			{
+				if(!grid.cell(x, y) && !visited.cell(x, y))
+				{
+					visited.setCell(x, y, 1);
+					queue.emplace_back(x, y);
+				}
+			};
+
+			if(pos.y_ > 0           ) visit(pos.x_, pos.y_-1);
+			if(pos.y_ < gridSize - 1) visit(pos.x_, pos.y_+1);
+			if(pos.x_ > 0           ) visit(pos.x_-1, pos.y_);
+			if(pos.x_ < gridSize - 1) visit(pos.x_+1, pos.y_);
+		}
+
+		checksum += queue.size();
+	}, 1);
+
+	println("  {:<18}{:>10.3f} s{:>10.3f} s{:>10.3f} s   (checksum {})", name, columnsSeconds, diagonalsSeconds, bfsSeconds, checksum);
+}
 
-	SUBCASE("ltrim(str)")
-	{
-		CHECK(aoc::StringUtils::ltrim(" test") == "test");
-	}
+void benchmarkGridLayouts()
+{
+	constexpr size_t gridSize = 8192;
 
-	SUBCASE("rtrim(str)")
+	vector<uint8_t> isWall(gridSize * gridSize);
+
+	uint64_t state = 0x9e3779b97f4a7c15;
+
+	for(auto& cell : isWall)
 	{
-		CHECK(aoc::StringUtils::rtrim("test ") == "test");
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+
+		cell = (state % 10 < 3);
 	}
 
-	SUBCASE("trim(str, char)")
+	isWall[(gridSize / 2) * gridSize + gridSize / 2] = 0;
+
+	println("grid layouts ({}x{} grid)", gridSize, gridSize);
+	println("  {:<18}{:>12}{:>12}{:>12}", "", "columns", "diagonals", "BFS");
+	benchmarkGridLayout<aoc::RowMajorLayout>("row-major", isWall, gridSize);
+	benchmarkGridLayout<aoc::TiledLayout<8>>("tiled 8x8", isWall, gridSize);
+	benchmarkGridLayout<aoc::TiledLayout<16>>("tiled 16x16", isWall, gridSize);
+	benchmarkGridLayout<aoc::MortonLayout>("Morton", isWall, gridSize);
+}
+
+void benchmarkGridPatterns()
+{
+	auto makeGrid = [](size_t gridSize)
 	{
-		CHECK(aoc::StringUtils::trim("=test=", '=') == "test");
-	}
+		aoc::BoundedGrid2D<char> grid(gridSize, gridSize);
 
-	SUBCASE("ltrim(str, char)")
+		uint64_t state = 0x9e3779b97f4a7c15;
+
+		for(size_t i=0; i<grid.numCells(); ++i)
+		{
+			state ^= state << 13;
+			state ^= state >> 7;
+			state ^= state << 17;
+
+			grid.data()[i] = "XMAS"[state >> 62];
+		}
+
+		return grid;
+	};
+
+	// The copying matcher is too slow for the large grid, so it runs on a
+	// smaller one and is compared by throughput.
+	const aoc::BoundedGrid2D<char> smallGrid = makeGrid(2000);
+	const aoc::BoundedGrid2D<char> largeGrid = makeGrid(10000);
+
+	const aoc::GridPattern xMasPattern({ "M.S", ".A.", "M.S" }, '.', aoc::GridPattern::rotations);
+	const aoc::GridPattern blockPattern({ "XM", "SA" }, '.', aoc::GridPattern::rotations | aoc::GridPattern::reflections);
+
+	size_t expectedCount = 0;
+
+	const double subGridSeconds = measureBestSeconds([&]()
 	{
-		CHECK(aoc::StringUtils::ltrim("_test", '_') == "test");
-	}
+		aoc::BoundedGrid2D<char> subGrid(3, 3);
 
-	SUBCASE("rtrim(str, char)")
+		size_t count = 0;
+
+		for(size_t x=0; x<smallGrid.width()-2; ++x)
+		{
+			for(size_t y=0; y<smallGrid.height()-2; ++y)
+			{
+				for(size_t x1=0; x1<3; ++x1)
+					for(size_t y1=0; y1<3; ++y1)
+						subGrid.setCell(x1, y1, smallGrid.cell(x+x1, y+y1));
+
+				if((subGrid.constTopDownDiagonal(2).toString() == "MAS" ||
+				    subGrid.constReverseTopDownDiagonal(2).toString() == "MAS") &&
+				   (subGrid.constBottomUpDiagonal(2).toString() == "MAS" ||
+				    subGrid.constReverseBottomUpDiagonal(2).toString() == "MAS"))
+					++count;
+			}
+		}
+
+		expectedCount = count;
+	}, 1);
+
+	AOC_ENFORCE(xMasPattern.count(smallGrid) == expectedCount);
+
+	size_t xMasCount = 0;
+	size_t blockCount = 0;
+
+	const double xMasSeconds = measureBestSeconds([&]()
 	{
-		CHECK(aoc::StringUtils::rtrim("test#", '#') == "test");
-	}
+		xMasCount = xMasPattern.count(largeGrid);
+	});
 
-	SUBCASE("generateVariations")
+	const double blockSeconds = measureBestSeconds([&]()
 	{
-		vector<string> variations;
+		blockCount = blockPattern.count(largeGrid);
+	});
 
-		aoc::StringUtils::generateVariations(set<char>({ 'a', 'b', 'c' }),
-		                                     2,
-		                                     variations);
+	println("grid patterns ({}x{} grid, {} X-MAS, {} 2x2 blocks)", largeGrid.width(), largeGrid.height(), xMasCount, blockCount);
+	printThroughput("  X-MAS, sub-grid copy + toString (before)", smallGrid.numCells(), subGridSeconds);
+	printThroughput("  X-MAS, GridPattern with rotations", largeGrid.numCells(), xMasSeconds);
+	printThroughput("  2x2 block, GridPattern with 8 transforms", largeGrid.numCells(), blockSeconds);
+}
 
-		CHECK(variations == vector<string>({ "aa", "ab", "ac", "ba", "bb", "bc", "ca", "cb", "cc" }));
-	}
+int main()
+{
+	benchmarkNewlineIndexing();
+	benchmarkIntegerParsing();
+	benchmarkTokenizing();
+	benchmarkReplacing();
+	benchmarkSubstringCounting();
+	benchmarkPatternMatching();
+	benchmarkGridScanning();
+	benchmarkGridPatterns();
+	benchmarkFloodFill();
+	benchmarkUnboundedWalk();
+	benchmarkShortestPaths();
+	benchmarkCellularAutomaton();
+	benchmarkGridLayouts();
+
+	return EXIT_SUCCESS;
 }
 
-#endif // #if defined(AOC_TEST)
+#endif // #if defined(AOC_BENCHMARK)
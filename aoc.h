@@ -5,14 +5,33 @@
 #include "fmt/format.h"
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
 #include <cmath>
+#include <condition_variable>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <regex>
 #include <set>
 #include <source_location>
+#include <span>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <tuple>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #define AOC_FUNCTIONIZE(_a, _b) \
@@ -87,6 +106,296 @@ std::vector<std::string> loadPuzzleInput(const std::string& puzzleInputFilePath)
 void panic(const std::string& message,
            const std::source_location sourceLocation=std::source_location::current());
 
+// Appends the offsets of all '\n' characters found in buffer to
+// newlineOffsets. Uses AVX2 when the CPU supports it, SSE2 otherwise.
+void findNewlines(std::string_view buffer, std::vector<size_t>& newlineOffsets);
+
+// Splits buffer into lines the same way a getline loop does (a trailing
+// newline does not produce an extra empty line), except that a '\r'
+// ending a line is not considered part of it.
+void splitLines(std::string_view buffer, std::vector<std::string_view>& lines);
+
+// Returns the number of bytes of data equal to value. Uses AVX2 when the CPU
+// supports it, SSE2 otherwise.
+size_t countBytes(const void* data, size_t size, uint8_t value);
+
+// Returns the offset of the first byte of data equal to any of values, or
+// size if there is none. Vectorized the same way as countBytes.
+size_t findAnyByte(const void* data, size_t size, std::span<const uint8_t> values);
+
+// Read-only view of a puzzle input file. The file is memory-mapped where
+// the platform allows it and lines are exposed as string_views into the
+// mapping, so no per-line allocation or copy takes place.
+class PuzzleInput
+{
+public:
+	typedef std::vector<std::string_view>::const_iterator const_iterator;
+
+public:
+	PuzzleInput() = default;
+	explicit PuzzleInput(const std::string& puzzleInputFilePath);
+
+	PuzzleInput(const PuzzleInput&) = delete;
+	PuzzleInput& operator=(const PuzzleInput&) = delete;
+
+	PuzzleInput(PuzzleInput&& other) noexcept;
+	PuzzleInput& operator=(PuzzleInput&& other) noexcept;
+
+	~PuzzleInput();
+
+public:
+	void load(const std::string& puzzleInputFilePath);
+	void clear();
+
+public:
+	std::string_view operator[](size_t index) const
+	{
+		AOC_ASSERT(index < lines_.size());
+
+		return lines_[index];
+	}
+
+	size_t size() const { return lines_.size(); }
+	bool empty() const { return lines_.empty(); }
+
+	const_iterator begin() const { return lines_.begin(); }
+	const_iterator end() const { return lines_.end(); }
+
+	std::string_view data() const { return std::string_view(data_, dataSize_); }
+
+	std::vector<std::string> toLines() const;
+
+private:
+	const char* data_ = nullptr;
+	size_t dataSize_ = 0;
+	void* mapping_ = nullptr;
+	size_t mappingSize_ = 0;
+	std::vector<char> buffer_;
+	std::vector<std::string_view> lines_;
+};
+
+// Pull-based reader yielding the lines of a puzzle input file one at a
+// time through a fixed-size read buffer, so that inputs of any size can be
+// processed in constant memory. The buffer only grows if a single line does
+// not fit into it. Lines are split the same way splitLines does it.
+class LineSource
+{
+public:
+	static constexpr size_t defaultBufferSize = 64 * 1024;
+
+public:
+	explicit LineSource(const std::string& puzzleInputFilePath,
+	                    size_t bufferSize=defaultBufferSize);
+
+public:
+	// Stores the next line in line and returns true, or returns false once
+	// the input is exhausted. The line stays valid until the next call.
+	bool nextLine(std::string_view& line);
+
+private:
+	void refill();
+
+private:
+	std::ifstream fileStream_;
+	std::vector<char> buffer_;
+	size_t pos_;
+	size_t size_;
+	bool isEndOfFile_;
+};
+
+// LineSource counterpart that overlaps reading with parsing: a background
+// thread fills one of two blocks while the caller consumes lines from the
+// other one. Only a line spanning two blocks gets copied.
+class ReadAheadLineSource
+{
+public:
+	static constexpr size_t defaultBlockSize = 1024 * 1024;
+
+public:
+	explicit ReadAheadLineSource(const std::string& puzzleInputFilePath,
+	                             size_t blockSize=defaultBlockSize);
+
+	ReadAheadLineSource(const ReadAheadLineSource&) = delete;
+	ReadAheadLineSource& operator=(const ReadAheadLineSource&) = delete;
+
+	~ReadAheadLineSource();
+
+public:
+	bool nextLine(std::string_view& line);
+
+private:
+	struct Block
+	{
+		std::vector<char> data_;
+		size_t size_ = 0;
+		bool isFilled_ = false;
+		bool isLast_ = false;
+	};
+
+private:
+	void readBlocks();
+	bool acquireNextBlock();
+	void releaseCurrentBlock();
+
+private:
+	std::ifstream fileStream_;
+	Block blocks_[2];
+	std::mutex mutex_;
+	std::condition_variable blockFilled_;
+	std::condition_variable blockReleased_;
+	bool isStopRequested_;
+	Block* currentBlock_;
+	size_t nextBlockIndex_;
+	size_t pos_;
+	bool isLastBlockAcquired_;
+	std::string pendingLine_;
+	bool isPendingLineConsumed_;
+	std::thread readerThread_;
+};
+
+// Parses lines on several threads: the input is split on line boundaries
+// into one contiguous chunk per thread, parseLine is run over every line of
+// each chunk and the per-chunk results are concatenated in input order.
+// parseLine has to be safe to call concurrently. An exception thrown by it
+// is rethrown on the calling thread once all chunks are done.
+template<class T>
+class ParallelLineParser
+{
+public:
+	static constexpr size_t defaultMinNumLinesPerChunk = 4096;
+	static constexpr size_t defaultMinNumBytesPerChunk = 256 * 1024;
+
+public:
+	explicit ParallelLineParser(size_t numThreads=std::max(1u, std::thread::hardware_concurrency()),
+	                            size_t minNumLinesPerChunk=defaultMinNumLinesPerChunk,
+	                            size_t minNumBytesPerChunk=defaultMinNumBytesPerChunk)
+		: numThreads_(numThreads)
+		, minNumLinesPerChunk_(minNumLinesPerChunk)
+		, minNumBytesPerChunk_(minNumBytesPerChunk)
+	{
+		AOC_ASSERT(numThreads >= 1);
+		AOC_ASSERT(minNumLinesPerChunk >= 1);
+		AOC_ASSERT(minNumBytesPerChunk >= 1);
+	}
+
+public:
+	// Lines is any random access container of lines, e.g.
+	// std::vector<std::string> or PuzzleInput.
+	template<class Lines, class ParseLine>
+	std::vector<T> parseLines(const Lines& lines, ParseLine parseLine) const
+	{
+		const size_t numLines = lines.size();
+		const size_t numChunks = numChunksFor(numLines, minNumLinesPerChunk_);
+
+		return parseChunks(numChunks, [&](size_t chunkIndex, std::vector<T>& results)
+		{
+			const size_t startIndex = numLines * chunkIndex / numChunks;
+			const size_t endIndex = numLines * (chunkIndex + 1) / numChunks;
+
+			results.reserve(endIndex - startIndex);
+
+			for(size_t i=startIndex; i<endIndex; ++i)
+				results.push_back(parseLine(lines[i]));
+		});
+	}
+
+	// Splits buffer into lines the same way splitLines does, with the line
+	// splitting itself also done in parallel.
+	template<class ParseLine>
+	std::vector<T> parseBuffer(std::string_view buffer, ParseLine parseLine) const
+	{
+		const size_t numChunks = numChunksFor(buffer.size(), minNumBytesPerChunk_);
+
+		std::vector<size_t> chunkStartPositions(numChunks + 1, buffer.size());
+
+		chunkStartPositions[0] = 0;
+
+		for(size_t i=1; i<numChunks; ++i)
+		{
+			const size_t pos = std::max(buffer.size() * i / numChunks, chunkStartPositions[i-1]);
+			const size_t newlinePos = buffer.find('\n', pos);
+
+			chunkStartPositions[i] = (newlinePos != std::string_view::npos) ? newlinePos + 1 : buffer.size();
+		}
+
+		return parseChunks(numChunks, [&](size_t chunkIndex, std::vector<T>& results)
+		{
+			const size_t startPos = chunkStartPositions[chunkIndex];
+			const size_t endPos = chunkStartPositions[chunkIndex + 1];
+
+			std::vector<std::string_view> lines;
+
+			splitLines(buffer.substr(startPos, endPos - startPos), lines);
+
+			results.reserve(lines.size());
+
+			for(std::string_view line : lines)
+				results.push_back(parseLine(line));
+		});
+	}
+
+private:
+	size_t numChunksFor(size_t inputSize, size_t minChunkSize) const
+	{
+		return std::max<size_t>(1, std::min(numThreads_, inputSize / minChunkSize));
+	}
+
+	template<class ParseChunk>
+	std::vector<T> parseChunks(size_t numChunks, ParseChunk parseChunk) const
+	{
+		std::vector<std::vector<T>> chunkResults(numChunks);
+		std::vector<std::exception_ptr> chunkExceptions(numChunks);
+
+		auto runChunk = [&](size_t chunkIndex)
+		{
+			try
+			{
+				parseChunk(chunkIndex, chunkResults[chunkIndex]);
+			}
+			catch(...)
+			{
+				chunkExceptions[chunkIndex] = std::current_exception();
+			}
+		};
+
+		std::vector<std::thread> threads;
+
+		for(size_t i=1; i<numChunks; ++i)
+			threads.emplace_back(runChunk, i);
+
+		runChunk(0);
+
+		for(auto& thread : threads)
+			thread.join();
+
+		for(const auto& chunkException : chunkExceptions)
+			if(chunkException)
+				std::rethrow_exception(chunkException);
+
+		if(numChunks == 1)
+			return std::move(chunkResults[0]);
+
+		size_t numResults = 0;
+
+		for(const auto& results : chunkResults)
+			numResults += results.size();
+
+		std::vector<T> mergedResults;
+
+		mergedResults.reserve(numResults);
+
+		for(auto& results : chunkResults)
+			std::move(results.begin(), results.end(), std::back_inserter(mergedResults));
+
+		return mergedResults;
+	}
+
+private:
+	size_t numThreads_;
+	size_t minNumLinesPerChunk_;
+	size_t minNumBytesPerChunk_;
+};
+
 template<class T>
 inline bool isEven(const T& value)
 {
@@ -238,7 +547,209 @@ inline Point2i nextPosition(const Point2i& position, Direction direction)
 	               position.y_ + deltaPositionFor[static_cast<size_t>(direction)].y_);
 }
 
+// Allocator handing out memory aligned to Alignment bytes, so that buffers
+// can be processed with aligned SIMD loads and rows start on cache lines.
+template<class T, size_t Alignment>
+class AlignedAllocator
+{
+public:
+	using value_type = T;
+
+	template<class U>
+	struct rebind
+	{
+		using other = AlignedAllocator<U, Alignment>;
+	};
+
+	AlignedAllocator() = default;
+
+	template<class U>
+	AlignedAllocator(const AlignedAllocator<U, Alignment>&)
+	{
+	}
+
+	T* allocate(size_t n)
+	{
+		return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+	}
+
+	void deallocate(T* p, size_t)
+	{
+		::operator delete(p, std::align_val_t(Alignment));
+	}
+
+	template<class U>
+	bool operator==(const AlignedAllocator<U, Alignment>&) const { return true; }
+};
+
+// Random-access iterator visiting every stride-th element starting at
+// start, used for grid columns and diagonals. Positions are kept as an
+// index so that no out-of-range pointer is ever formed.
 template<class T>
+class StridedIterator
+{
+public:
+	using iterator_category = std::random_access_iterator_tag;
+	using iterator_concept = std::random_access_iterator_tag;
+	using value_type = std::remove_cv_t<T>;
+	using difference_type = std::ptrdiff_t;
+	using pointer = T*;
+	using reference = T&;
+
+	StridedIterator() = default;
+
+	StridedIterator(T* start, difference_type index, difference_type stride)
+		: start_(start)
+		, index_(index)
+		, stride_(stride)
+	{
+	}
+
+	template<class U>
+		requires std::is_convertible_v<U*, T*>
+	StridedIterator(const StridedIterator<U>& other)
+		: start_(other.start())
+		, index_(other.index())
+		, stride_(other.stride())
+	{
+	}
+
+	T* start() const { return start_; }
+	difference_type index() const { return index_; }
+	difference_type stride() const { return stride_; }
+
+	reference operator*() const { return start_[index_ * stride_]; }
+	pointer operator->() const { return &start_[index_ * stride_]; }
+	reference operator[](difference_type n) const { return start_[(index_ + n) * stride_]; }
+
+	StridedIterator& operator++() { ++index_; return *this; }
+	StridedIterator operator++(int) { StridedIterator it = *this; ++index_; return it; }
+	StridedIterator& operator--() { --index_; return *this; }
+	StridedIterator operator--(int) { StridedIterator it = *this; --index_; return it; }
+
+	StridedIterator& operator+=(difference_type n) { index_ += n; return *this; }
+	StridedIterator& operator-=(difference_type n) { index_ -= n; return *this; }
+
+	StridedIterator operator+(difference_type n) const { return StridedIterator(start_, index_ + n, stride_); }
+	StridedIterator operator-(difference_type n) const { return StridedIterator(start_, index_ - n, stride_); }
+	friend StridedIterator operator+(difference_type n, const StridedIterator& it) { return it + n; }
+
+	difference_type operator-(const StridedIterator& other) const { return index_ - other.index_; }
+
+	bool operator==(const StridedIterator& other) const { return index_ == other.index_; }
+	auto operator<=>(const StridedIterator& other) const { return index_ <=> other.index_; }
+
+private:
+	T* start_ = nullptr;
+	difference_type index_ = 0;
+	difference_type stride_ = 1;
+};
+
+// Storage layout policies for BoundedGrid2D. A layout is constructed for the
+// grid's dimensions and maps cell (x, y) to an index into a buffer of size()
+// cells; buffer cells that belong to no (x, y) hold the grid's init cell.
+
+// Rows one after another; the only layout with rows and strided views
+// addressable through data().
+class RowMajorLayout
+{
+public:
+	static constexpr bool isRowMajor = true;
+
+public:
+	RowMajorLayout(size_t width=0, size_t height=0)
+		: width_(width)
+		, height_(height)
+	{
+	}
+
+public:
+	size_t index(size_t x, size_t y) const { return y * width_ + x; }
+	size_t size() const { return width_ * height_; }
+
+private:
+	size_t width_;
+	size_t height_;
+};
+
+// Square tiles of TileSize x TileSize cells, stored row-major inside a tile,
+// with tiles stored row-major in the grid. Edge tiles are allocated whole.
+template<size_t TileSize>
+class TiledLayout
+{
+public:
+	static constexpr bool isRowMajor = false;
+
+	static_assert(std::has_single_bit(TileSize), "the tile size must be a power of two");
+
+public:
+	TiledLayout(size_t width=0, size_t height=0)
+		: numTilesPerRow_((width + TileSize - 1) / TileSize)
+		, numTileRows_((height + TileSize - 1) / TileSize)
+	{
+	}
+
+public:
+	size_t index(size_t x, size_t y) const
+	{
+		const size_t tileIndex = (y / TileSize) * numTilesPerRow_ + x / TileSize;
+
+		return tileIndex * TileSize * TileSize + (y % TileSize) * TileSize + x % TileSize;
+	}
+
+	size_t size() const { return numTilesPerRow_ * numTileRows_ * TileSize * TileSize; }
+
+private:
+	size_t numTilesPerRow_;
+	size_t numTileRows_;
+};
+
+// Z-order: the bits of x and y are interleaved, so cells close in both
+// directions stay close in memory at every scale. The index grows in both x
+// and y, so the buffer ends at the index of the last cell; grids far from
+// square waste most of it.
+class MortonLayout
+{
+public:
+	static constexpr bool isRowMajor = false;
+
+public:
+	MortonLayout(size_t width=0, size_t height=0)
+		: size_((width == 0 || height == 0) ? 0 : index(width - 1, height - 1) + 1)
+	{
+		AOC_ASSERT(width <= (size_t(1) << 32) && height <= (size_t(1) << 32));
+	}
+
+public:
+	size_t index(size_t x, size_t y) const
+	{
+		return spreadBits(x) | (spreadBits(y) << 1);
+	}
+
+	size_t size() const { return size_; }
+
+private:
+	// Moves bit i of the lower 32 bits of value to bit 2 * i.
+	static uint64_t spreadBits(uint64_t value)
+	{
+		value &= 0x00000000ffffffff;
+		value = (value | (value << 16)) & 0x0000ffff0000ffff;
+		value = (value | (value <<  8)) & 0x00ff00ff00ff00ff;
+		value = (value | (value <<  4)) & 0x0f0f0f0f0f0f0f0f;
+		value = (value | (value <<  2)) & 0x3333333333333333;
+		value = (value | (value <<  1)) & 0x5555555555555555;
+
+		return value;
+	}
+
+private:
+	size_t size_;
+};
+
+// Row, column and diagonal views iterate data() with a fixed stride and so
+// are only available with RowMajorLayout; their operator[] and toString()
+// work with every layout.
+template<class T, class Layout=RowMajorLayout>
 class BoundedGrid2D
 {
 public:
@@ -263,6 +774,14 @@ public:
 
 		size_t length() const { return grid_.width(); }
 
+		T* begin() { return grid_.data() + y_ * grid_.rowStride(); }
+		T* end() { return begin() + length(); }
+		const T* begin() const { return grid_.data() + y_ * grid_.rowStride(); }
+		const T* end() const { return begin() + length(); }
+
+		std::span<T> span() { return std::span<T>(begin(), length()); }
+		std::span<const T> span() const { return std::span<const T>(begin(), length()); }
+
 		DEFINE_BOUNDED_GRID2D_SEQUENCE_TO_STRING_METHOD();
 
 	private:
@@ -291,6 +810,11 @@ public:
 
 		size_t length() const { return grid_.width(); }
 
+		const T* begin() const { return grid_.data() + y_ * grid_.rowStride(); }
+		const T* end() const { return begin() + length(); }
+
+		std::span<const T> span() const { return std::span<const T>(begin(), length()); }
+
 		DEFINE_BOUNDED_GRID2D_SEQUENCE_TO_STRING_METHOD();
 
 	private:
@@ -327,6 +851,11 @@ public:
 
 		size_t length() const { return grid_.height(); }
 
+		StridedIterator<T> begin() { return StridedIterator<T>(grid_.data() + x_, 0, grid_.rowStride()); }
+		StridedIterator<T> end() { return begin() + length(); }
+		StridedIterator<const T> begin() const { return StridedIterator<const T>(grid_.data() + x_, 0, grid_.rowStride()); }
+		StridedIterator<const T> end() const { return begin() + length(); }
+
 		DEFINE_BOUNDED_GRID2D_SEQUENCE_TO_STRING_METHOD();
 
 	private:
@@ -356,6 +885,9 @@ public:
 
 		size_t length() const { return grid_.height(); }
 
+		StridedIterator<const T> begin() const { return StridedIterator<const T>(grid_.data() + x_, 0, grid_.rowStride()); }
+		StridedIterator<const T> end() const { return begin() + length(); }
+
 		DEFINE_BOUNDED_GRID2D_SEQUENCE_TO_STRING_METHOD();
 
 	private:
@@ -405,6 +937,11 @@ public:
 
 		size_t length() const { return length_; }
 
+		StridedIterator<T> begin() { return StridedIterator<T>(grid_.data() + startY_ * grid_.rowStride() + startX_, 0, static_cast<std::ptrdiff_t>(grid_.rowStride()) + 1); }
+		StridedIterator<T> end() { return begin() + length(); }
+		StridedIterator<const T> begin() const { return StridedIterator<const T>(grid_.data() + startY_ * grid_.rowStride() + startX_, 0, static_cast<std::ptrdiff_t>(grid_.rowStride()) + 1); }
+		StridedIterator<const T> end() const { return begin() + length(); }
+
 		DEFINE_BOUNDED_GRID2D_SEQUENCE_TO_STRING_METHOD();
 
 	private:
@@ -440,6 +977,9 @@ public:
 
 		size_t length() const { return length_; }
 
+		StridedIterator<const T> begin() const { return StridedIterator<const T>(grid_.data() + startY_ * grid_.rowStride() + startX_, 0, static_cast<std::ptrdiff_t>(grid_.rowStride()) + 1); }
+		StridedIterator<const T> end() const { return begin() + length(); }
+
 		DEFINE_BOUNDED_GRID2D_SEQUENCE_TO_STRING_METHOD();
 
 	private:
@@ -495,6 +1035,11 @@ public:
 
 		size_t length() const { return length_; }
 
+		StridedIterator<T> begin() { return StridedIterator<T>(grid_.data() + startY_ * grid_.rowStride() + startX_, 0, 1 - static_cast<std::ptrdiff_t>(grid_.rowStride())); }
+		StridedIterator<T> end() { return begin() + length(); }
+		StridedIterator<const T> begin() const { return StridedIterator<const T>(grid_.data() + startY_ * grid_.rowStride() + startX_, 0, 1 - static_cast<std::ptrdiff_t>(grid_.rowStride())); }
+		StridedIterator<const T> end() const { return begin() + length(); }
+
 		DEFINE_BOUNDED_GRID2D_SEQUENCE_TO_STRING_METHOD();
 
 	private:
@@ -537,6 +1082,9 @@ public:
 
 		size_t length() const { return length_; }
 
+		StridedIterator<const T> begin() const { return StridedIterator<const T>(grid_.data() + startY_ * grid_.rowStride() + startX_, 0, 1 - static_cast<std::ptrdiff_t>(grid_.rowStride())); }
+		StridedIterator<const T> end() const { return begin() + length(); }
+
 		DEFINE_BOUNDED_GRID2D_SEQUENCE_TO_STRING_METHOD();
 
 	private:
@@ -584,6 +1132,11 @@ public:
 
 		size_t length() const { return sequence_.length(); }
 
+		auto begin() { return std::make_reverse_iterator(sequence_.end()); }
+		auto end() { return std::make_reverse_iterator(sequence_.begin()); }
+		auto begin() const { return std::make_reverse_iterator(sequence_.end()); }
+		auto end() const { return std::make_reverse_iterator(sequence_.begin()); }
+
 		DEFINE_BOUNDED_GRID2D_SEQUENCE_TO_STRING_METHOD();
 
 	private:
@@ -609,6 +1162,9 @@ public:
 
 		size_t length() const { return sequence_.length(); }
 
+		auto begin() const { return std::make_reverse_iterator(sequence_.end()); }
+		auto end() const { return std::make_reverse_iterator(sequence_.begin()); }
+
 		std::string toString() const
 		{
 			std::string result;
@@ -718,62 +1274,73 @@ public:
 
 public:
 	static constexpr size_t npos = std::string::npos;
+	static constexpr size_t alignment = 64;
+
+	// std::vector<bool> packs its elements, so there would be no data().
+	static_assert(!std::is_same_v<T, bool>, "BoundedGrid2D<bool> is not supported");
+
+	// Byte-sized cells compare equal exactly when their bytes do, so count and
+	// the find methods can scan the cell buffer with countBytes/findAnyByte.
+	static constexpr bool hasByteCells = (sizeof(T) == 1) && (std::is_integral_v<T> || std::is_enum_v<T>);
 
 public:
 	BoundedGrid2D(size_t width=0, size_t height=0, const T& initCell=T())
-		: cells_(height, std::vector<T>(width, initCell))
+		: cells_(Layout(width, height).size(), initCell)
+		, layout_(width, height)
+		, width_(width)
+		, height_(height)
 	{
 	}
 
 	BoundedGrid2D(const std::vector<std::string>& lines)
-		: cells_(0, std::vector<T>(0))
 	{
 		reset(lines);
 	}
 
-public:
-	void reset(size_t width, size_t height, const T& initCell=T())
+	BoundedGrid2D(const PuzzleInput& lines)
 	{
-		cells_.assign(height, std::vector<T>(width, initCell));
+		reset(lines);
 	}
 
-	void reset(const std::vector<std::string>& lines)
+public:
+	void reset(size_t width, size_t height, const T& initCell=T())
 	{
-		AOC_ASSERT(!lines.empty());
-		AOC_ASSERT(!(lines[0].empty()));
-
-		reset(lines[0].size(), lines.size());
-
-		setCells(lines);
+		layout_ = Layout(width, height);
+		cells_.assign(layout_.size(), initCell);
+		width_ = width;
+		height_ = height;
 	}
 
+	void reset(const std::vector<std::string>& lines) { resetFromLines(lines); }
+	void reset(const PuzzleInput& lines) { resetFromLines(lines); }
+
 public:
 	T& cell(size_t x, size_t y)
 	{
 		AOC_ASSERT(x < width() && y < height());
 
-		return cells_[y][x];
+		return cells_[layout_.index(x, y)];
 	}
 
 	const T& cell(size_t x, size_t y) const
 	{
 		AOC_ASSERT(x < width() && y < height());
 
-		return cells_[y][x];
+		return cells_[layout_.index(x, y)];
 	}
 
 	T& cell(const Point2uz& pos)
 	{
 		AOC_ASSERT(pos.x_ < width() && pos.y_ < height());
 
-		return cells_[pos.y_][pos.x_];
+		return cells_[layout_.index(pos.x_, pos.y_)];
 	}
 
 	const T& cell(const Point2uz& pos) const
 	{
 		AOC_ASSERT(pos.x_ < width() && pos.y_ < height());
 
-		return cells_[pos.y_][pos.x_];
+		return cells_[layout_.index(pos.x_, pos.y_)];
 	}
 
 	T& cell(const Point2i& pos)
@@ -781,7 +1348,7 @@ public:
 		AOC_ASSERT(pos.x_ >= 0 && pos.x_ < width() &&
 		           pos.y_ >= 0 && pos.y_ < height());
 
-		return cells_[pos.y_][pos.x_];
+		return cells_[layout_.index(pos.x_, pos.y_)];
 	}
 
 	const T& cell(const Point2i& pos) const
@@ -789,21 +1356,21 @@ public:
 		AOC_ASSERT(pos.x_ >= 0 && pos.x_ < width() &&
 		           pos.y_ >= 0 && pos.y_ < height());
 
-		return cells_[pos.y_][pos.x_];
+		return cells_[layout_.index(pos.x_, pos.y_)];
 	}
 
 	void setCell(size_t x, size_t y, const T& cell)
 	{
 		AOC_ASSERT(x < width() && y < height());
 
-		cells_[y][x] = cell;
+		cells_[layout_.index(x, y)] = cell;
 	}
 
 	void setCell(const Point2uz& pos, const T& cell)
 	{
 		AOC_ASSERT(pos.x_ < width() && pos.y_ < height());
 
-		cells_[pos.y_][pos.x_] = cell;
+		cells_[layout_.index(pos.x_, pos.y_)] = cell;
 	}
 
 	void setCell(const Point2i& pos, const T& cell)
@@ -811,40 +1378,36 @@ public:
 		AOC_ASSERT(pos.x_ >= 0 && pos.x_ < width() &&
 		           pos.y_ >= 0 && pos.y_ < height());
 
-		cells_[pos.y_][pos.x_] = cell;
+		cells_[layout_.index(pos.x_, pos.y_)] = cell;
 	}
 
-	void setCells(const std::vector<std::string>& lines)
-	{
-		AOC_ASSERT(lines.size() == height());
-
-		size_t y = 0;
-
-		for(const auto& line : lines)
-		{
-			AOC_ASSERT(line.length() == width());
-
-			size_t x = 0;
-
-			for(char ch : line)
-			{
-				cells_[y][x] = fromChar<T>(ch);
+	void setCells(const std::vector<std::string>& lines) { setCellsFromLines(lines); }
+	void setCells(const PuzzleInput& lines) { setCellsFromLines(lines); }
 
-				++x;
-			}
+	size_t width() const
+	{
+		return width_;
+	}
 
-			++y;
-		}
+	size_t height() const
+	{
+		return height_;
 	}
 
-	size_t width() const
+	// Cells are stored in a single buffer aligned to alignment bytes; cell
+	// (x, y) lives at data()[layout().index(x, y)], which is
+	// data()[y * rowStride() + x] for the default row-major layout.
+	T* data() { return cells_.data(); }
+	const T* data() const { return cells_.data(); }
+
+	const Layout& layout() const
 	{
-		return cells_.size() > 0 ? cells_[0].size() : 0;
+		return layout_;
 	}
 
-	size_t height() const
+	size_t rowStride() const requires Layout::isRowMajor
 	{
-		return cells_.size();
+		return width_;
 	}
 
 	size_t numCells() const
@@ -878,30 +1441,63 @@ public:
 
 	size_t count(const T& cell) const
 	{
-		const size_t w = width();
-		const size_t h = height();
-
-		size_t counter = 0;
+		if constexpr(!Layout::isRowMajor)
+		{
+			size_t numCells = 0;
 
-		for(size_t y=0; y<h; ++y)
-			for(size_t x=0; x<w; ++x)
-				if(cells_[y][x] == cell)
-					++counter;
+			for(size_t y=0; y<height_; ++y)
+				for(size_t x=0; x<width_; ++x)
+					numCells += (cells_[layout_.index(x, y)] == cell);
 
-		return counter;
+			return numCells;
+		}
+		else if constexpr(hasByteCells)
+			return countBytes(cells_.data(), cells_.size(), toByte(cell));
+		else
+			return std::count(cells_.begin(), cells_.end(), cell);
 	}
 
 	Point2uz findCell(const T& cell) const
 	{
-		const size_t w = width();
-		const size_t h = height();
+		return findAnyCell(std::span<const T>(&cell, 1));
+	}
 
-		for(size_t y=0; y<h; ++y)
-			for(size_t x=0; x<w; ++x)
-				if(cells_[y][x] == cell)
-					return Point2uz(x, y);
+	// Returns the position of the first cell, in row-major order, that equals
+	// any of cells.
+	Point2uz findAnyCell(std::span<const T> cells) const
+	{
+		if constexpr(!Layout::isRowMajor)
+		{
+			for(size_t y=0; y<height_; ++y)
+				for(size_t x=0; x<width_; ++x)
+					if(std::find(cells.begin(), cells.end(), cells_[layout_.index(x, y)]) != cells.end())
+						return Point2uz(x, y);
+
+			return Point2uz(npos, npos);
+		}
+		else
+		{
+			size_t index = 0;
+
+			if constexpr(hasByteCells)
+			{
+				const std::span<const uint8_t> values(reinterpret_cast<const uint8_t*>(cells.data()), cells.size());
+
+				index = findAnyByte(cells_.data(), cells_.size(), values);
+			}
+			else
+				index = std::find_first_of(cells_.begin(), cells_.end(), cells.begin(), cells.end()) - cells_.begin();
+
+			if(index == cells_.size())
+				return Point2uz(npos, npos);
 
-		return Point2uz(npos, npos);
+			return Point2uz(index % rowStride(), index / rowStride());
+		}
+	}
+
+	Point2uz findAnyCell(std::initializer_list<T> cells) const
+	{
+		return findAnyCell(std::span<const T>(cells.begin(), cells.size()));
 	}
 
 	std::string toString() const
@@ -911,11 +1507,13 @@ public:
 		const size_t w = width();
 		const size_t h = height();
 
+		result.reserve((w + 1) * h);
+
 		for(size_t y=0; y<h; ++y)
 		{
 			for(size_t x=0; x<w; ++x)
 			{
-				result += toChar<T>(cells_[y][x]);
+				result += toChar<T>(cells_[layout_.index(x, y)]);
 			}
 
 			result += '\n';
@@ -953,110 +1551,2096 @@ public:
 	ConstAdjacentNeighbors constAdjacentNeighbors(size_t x, size_t y) const { return ConstAdjacentNeighbors(*this, x, y); }
 
 private:
-	std::vector<std::vector<T>> cells_;
-};
+	static uint8_t toByte(const T& cell)
+	{
+		uint8_t byte;
 
-#undef DEFINE_BOUNDED_GRID2D_SEQUENCE_TO_STRING_METHOD
+		std::memcpy(&byte, &cell, 1);
 
-template<class T=int>
-class PuzzleSolution
-{
-public:
-	virtual ~PuzzleSolution() {}
+		return byte;
+	}
 
-public:
-	int run(const std::string& puzzleInputFilePath);
+	template<class Lines>
+	void resetFromLines(const Lines& lines)
+	{
+		AOC_ASSERT(!lines.empty());
+		AOC_ASSERT(!(lines[0].empty()));
 
-protected:
-	const std::vector<std::string>& input() const { return input_; }
+		reset(lines[0].size(), lines.size());
 
-protected:
-	virtual void processInput(const std::string& puzzleInputFilePath);
+		setCellsFromLines(lines);
+	}
 
-private:
-	virtual T answer1() = 0;
-	virtual T answer2() = 0;
+	template<class Lines>
+	void setCellsFromLines(const Lines& lines)
+	{
+		AOC_ASSERT(lines.size() == height());
+
+		size_t y = 0;
+
+		for(const auto& line : lines)
+		{
+			AOC_ASSERT(line.length() == width());
+
+			if constexpr(std::is_same_v<T, char> && Layout::isRowMajor)
+				std::memcpy(data() + y * rowStride(), line.data(), line.length());
+			else
+			{
+				size_t x = 0;
+
+				for(char ch : line)
+				{
+					cells_[layout_.index(x, y)] = fromChar<T>(ch);
+
+					++x;
+				}
+			}
+
+			++y;
+		}
+	}
 
 private:
-	std::vector<std::string> input_;
+	std::vector<T, AlignedAllocator<T, alignment>> cells_;
+	Layout layout_;
+	size_t width_ = 0;
+	size_t height_ = 0;
 };
 
+#undef DEFINE_BOUNDED_GRID2D_SEQUENCE_TO_STRING_METHOD
+
+// A grid surrounded by a border of padding() cells holding a sentinel value,
+// so that the cells around any interior cell can be read by linear offset
+// without bounds checks. x and y always refer to the interior; index() maps
+// them to the linear index into the padded buffer used by operator[].
 template<class T>
-int PuzzleSolution<T>::run(const std::string& puzzleInputFilePath)
+class PaddedGrid2D
 {
-	processInput(puzzleInputFilePath);
+public:
+	PaddedGrid2D(size_t width=0, size_t height=0, size_t padding=1, const T& sentinel=T(), const T& initCell=T())
+	{
+		reset(width, height, padding, sentinel, initCell);
+	}
 
-	fmt::println("{}", answer1());
-	fmt::println("{}", answer2());
+	PaddedGrid2D(const BoundedGrid2D<T>& grid, size_t padding=1, const T& sentinel=T())
+	{
+		reset(grid, padding, sentinel);
+	}
 
-	return EXIT_SUCCESS;
-}
+public:
+	void reset(size_t width, size_t height, size_t padding=1, const T& sentinel=T(), const T& initCell=T())
+	{
+		width_ = width;
+		height_ = height;
+		padding_ = padding;
+		rowStride_ = width + 2 * padding;
+		sentinel_ = sentinel;
 
-template<class T>
-void PuzzleSolution<T>::processInput(const std::string& puzzleInputFilePath)
-{
-	input_ = loadPuzzleInput(puzzleInputFilePath);
-}
+		cells_.assign(rowStride_ * (height + 2 * padding), sentinel);
+
+		for(size_t y=0; y<height; ++y)
+			std::fill_n(cells_.begin() + index(0, y), width, initCell);
+	}
+
+	void reset(const BoundedGrid2D<T>& grid, size_t padding=1, const T& sentinel=T())
+	{
+		reset(grid.width(), grid.height(), padding, sentinel);
+
+		for(size_t y=0; y<height_; ++y)
+			std::copy_n(grid.data() + y * grid.rowStride(), width_, cells_.begin() + index(0, y));
+	}
 
-class MathUtils
-{
 public:
-	template<class T>
-	static bool isInRange(const T& value, const T& rangeStart, const T& rangeEnd)
+	T& cell(size_t x, size_t y)
 	{
-		return (value >= rangeStart) && (value <= rangeEnd);
+		AOC_ASSERT(x < width() && y < height());
+
+		return cells_[index(x, y)];
 	}
 
-	static int manhattanDistance(int x1, int y1, int x2, int y2)
+	const T& cell(size_t x, size_t y) const
 	{
-		return abs(x2 - x1) + abs(y2 - y1);
+		AOC_ASSERT(x < width() && y < height());
+
+		return cells_[index(x, y)];
+	}
+
+	T& cell(const Point2uz& pos) { return cell(pos.x_, pos.y_); }
+	const T& cell(const Point2uz& pos) const { return cell(pos.x_, pos.y_); }
+
+	void setCell(size_t x, size_t y, const T& cell)
+	{
+		AOC_ASSERT(x < width() && y < height());
+
+		cells_[index(x, y)] = cell;
+	}
+
+	void setCell(const Point2uz& pos, const T& cell) { setCell(pos.x_, pos.y_, cell); }
+
+	// Any index of the padded buffer is valid here, including the border.
+	T& operator[](size_t index)
+	{
+		AOC_ASSERT(index < cells_.size());
+
+		return cells_[index];
+	}
+
+	const T& operator[](size_t index) const
+	{
+		AOC_ASSERT(index < cells_.size());
+
+		return cells_[index];
+	}
+
+	size_t index(size_t x, size_t y) const
+	{
+		return (y + padding_) * rowStride_ + x + padding_;
+	}
+
+	size_t index(const Point2uz& pos) const
+	{
+		return index(pos.x_, pos.y_);
+	}
+
+	// The interior position of an index that is not on the border.
+	Point2uz position(size_t index) const
+	{
+		AOC_ASSERT(index < cells_.size());
+
+		return Point2uz(index % rowStride_ - padding_, index / rowStride_ - padding_);
+	}
+
+	ptrdiff_t offset(int dx, int dy) const
+	{
+		AOC_ASSERT(static_cast<size_t>(std::abs(dx)) <= padding_ &&
+		           static_cast<size_t>(std::abs(dy)) <= padding_);
+
+		return dy * static_cast<ptrdiff_t>(rowStride_) + dx;
 	}
+
+	ptrdiff_t offset(Direction direction) const
+	{
+		const Point2i delta = deltaPositionFor[static_cast<size_t>(direction)];
+
+		return offset(delta.x_, delta.y_);
+	}
+
+	// Offsets of the four adjacent cells, in Direction order.
+	std::array<ptrdiff_t, 4> adjacentOffsets() const
+	{
+		return { offset(Direction::North), offset(Direction::East), offset(Direction::South), offset(Direction::West) };
+	}
+
+	size_t width() const
+	{
+		return width_;
+	}
+
+	size_t height() const
+	{
+		return height_;
+	}
+
+	size_t padding() const
+	{
+		return padding_;
+	}
+
+	const T& sentinel() const
+	{
+		return sentinel_;
+	}
+
+	size_t numCells() const
+	{
+		return width() * height();
+	}
+
+	// The padded buffer, border included.
+	T* data() { return cells_.data(); }
+	const T* data() const { return cells_.data(); }
+
+	size_t size() const
+	{
+		return cells_.size();
+	}
+
+	size_t rowStride() const
+	{
+		return rowStride_;
+	}
+
+	std::string toString() const
+	{
+		std::string result;
+
+		result.reserve((width_ + 1) * height_);
+
+		for(size_t y=0; y<height_; ++y)
+		{
+			for(size_t x=0; x<width_; ++x)
+				result += toChar<T>(cells_[index(x, y)]);
+
+			result += '\n';
+		}
+
+		return result;
+	}
+
+private:
+	std::vector<T, AlignedAllocator<T, BoundedGrid2D<T>::alignment>> cells_;
+	size_t width_ = 0;
+	size_t height_ = 0;
+	size_t padding_ = 0;
+	size_t rowStride_ = 0;
+	T sentinel_ = T();
 };
 
-class StringUtils
+// A modifiable grid layered over a read-only base grid. Writes go to a working
+// copy of the base and the index of every cell written for the first time is
+// logged, so reset() puts the base values back in O(number of written cells).
+// Meant for running many what-if variations of the same grid.
+template<class T, class Layout=RowMajorLayout>
+class OverlayGrid2D
 {
 public:
-	static bool contains(const std::string& str,
-	                     const std::string& substr);
-	static bool contains(const std::string& str, char ch);
+	explicit OverlayGrid2D(const BoundedGrid2D<T, Layout>& base)
+		: base_(base)
+		, cells_(base)
+		, isModified_(base.layout().size(), false)
+	{
+	}
 
-	static size_t countOverlappingSubstrings(const std::string& str,
-	                                         const std::string& substr);
-	static size_t countNonOverlappingSubstrings(const std::string& str,
-	                                            const std::string& substr);
+public:
+	const T& cell(size_t x, size_t y) const
+	{
+		return cells_.cell(x, y);
+	}
 
-	static std::string replaceFirst(const std::string& str,
-	                                const std::string& substr,
-	                                const std::string& substr2);
-	static std::string replaceLast(const std::string& str,
-	                               const std::string& substr,
-	                               const std::string& substr2);
-	static std::string replaceAll(const std::string& str,
-	                              const std::string& substr,
-	                              const std::string& substr2);
+	const T& cell(const Point2uz& pos) const
+	{
+		return cells_.cell(pos);
+	}
 
-	static std::vector<std::string> tokenize(const std::string& str,
-	                                         char delimiter=',',
-	                                         bool trimWhitespace=true,
-	                                         bool skipEmptyTokens=false);
+	const T& cell(const Point2i& pos) const
+	{
+		return cells_.cell(pos);
+	}
 
-	static std::string trim(const std::string& str);
-	static std::string ltrim(const std::string& str);
-	static std::string rtrim(const std::string& str);
+	void setCell(size_t x, size_t y, const T& cell)
+	{
+		AOC_ASSERT(x < width() && y < height());
 
-	static std::string trim(std::string str, char ch);
-	static std::string ltrim(std::string str, char ch);
-	static std::string rtrim(std::string str, char ch);
+		const size_t index = cells_.layout().index(x, y);
 
-	static void generateVariations(const std::set<char>& elements,
-	                               size_t k,
-	                               std::vector<std::string>& variations);
+		if(!isModified_[index])
+		{
+			isModified_[index] = true;
+			modifiedIndices_.push_back(index);
+		}
+
+		cells_.data()[index] = cell;
+	}
+
+	void setCell(const Point2uz& pos, const T& cell)
+	{
+		setCell(pos.x_, pos.y_, cell);
+	}
+
+	void setCell(const Point2i& pos, const T& cell)
+	{
+		AOC_ASSERT(pos.x_ >= 0 && pos.y_ >= 0);
+
+		setCell(static_cast<size_t>(pos.x_), static_cast<size_t>(pos.y_), cell);
+	}
+
+	void reset()
+	{
+		for(size_t index : modifiedIndices_)
+		{
+			cells_.data()[index] = base_.data()[index];
+			isModified_[index] = false;
+		}
+
+		modifiedIndices_.clear();
+	}
+
+	size_t numModifiedCells() const
+	{
+		return modifiedIndices_.size();
+	}
+
+	const BoundedGrid2D<T, Layout>& base() const
+	{
+		return base_;
+	}
+
+	// The base grid with all modifications applied.
+	const BoundedGrid2D<T, Layout>& grid() const
+	{
+		return cells_;
+	}
+
+	size_t width() const { return cells_.width(); }
+	size_t height() const { return cells_.height(); }
+	size_t numCells() const { return cells_.numCells(); }
+
+	size_t count(const T& cell) const { return cells_.count(cell); }
+	Point2uz findCell(const T& cell) const { return cells_.findCell(cell); }
+	Point2uz findAnyCell(std::span<const T> cells) const { return cells_.findAnyCell(cells); }
+	Point2uz findAnyCell(std::initializer_list<T> cells) const { return cells_.findAnyCell(cells); }
+
+	std::string toString() const { return cells_.toString(); }
 
 private:
+	const BoundedGrid2D<T, Layout>& base_;
+	BoundedGrid2D<T, Layout> cells_;
+	std::vector<bool> isModified_;
+	std::vector<size_t> modifiedIndices_;
+};
+
+// A grid without bounds: cells live in dense ChunkSize x ChunkSize chunks
+// that are allocated on first write, found through a hash map keyed by chunk
+// coordinates. The last chunk used by a non-const access is cached, so walks
+// that stay close together rarely touch the map; const reads leave the cache
+// alone and are safe to run concurrently. Cells never written read as the
+// init cell.
+template<class T, size_t ChunkSize=64>
+class UnboundedGrid2D
+{
+	static_assert(std::has_single_bit(ChunkSize), "the chunk size must be a power of two");
+
+public:
+	static constexpr size_t chunkSize = ChunkSize;
+
+public:
+	explicit UnboundedGrid2D(const T& initCell=T())
+		: initCell_(initCell)
+	{
+	}
+
+	UnboundedGrid2D(const UnboundedGrid2D&) = delete;
+	UnboundedGrid2D& operator=(const UnboundedGrid2D&) = delete;
+
+public:
+	void clear()
+	{
+		chunks_.clear();
+		lastChunk_ = nullptr;
+	}
+
+	const T& cell(int x, int y) const
+	{
+		const Chunk* chunk = findChunk(chunkKey(x, y));
+
+		return chunk ? (*chunk)[cellIndex(x, y)] : initCell_;
+	}
+
+	const T& cell(const Point2i& pos) const
+	{
+		return cell(pos.x_, pos.y_);
+	}
+
+	T& cell(int x, int y)
+	{
+		return chunk(chunkKey(x, y))[cellIndex(x, y)];
+	}
+
+	T& cell(const Point2i& pos)
+	{
+		return cell(pos.x_, pos.y_);
+	}
+
+	void setCell(int x, int y, const T& cell)
+	{
+		chunk(chunkKey(x, y))[cellIndex(x, y)] = cell;
+	}
+
+	void setCell(const Point2i& pos, const T& cell)
+	{
+		setCell(pos.x_, pos.y_, cell);
+	}
+
+	// Sets the cell and returns whether it was already set.
+	bool testAndSetCell(int x, int y) requires std::is_same_v<T, bool>
+	{
+		T& currentCell = cell(x, y);
+
+		const bool wasSet = currentCell;
+
+		currentCell = true;
+
+		return wasSet;
+	}
+
+	bool testAndSetCell(const Point2i& pos) requires std::is_same_v<T, bool>
+	{
+		return testAndSetCell(pos.x_, pos.y_);
+	}
+
+	size_t numChunks() const
+	{
+		return chunks_.size();
+	}
+
+	size_t numAllocatedCells() const
+	{
+		return numChunks() * ChunkSize * ChunkSize;
+	}
+
+private:
+	typedef std::array<T, ChunkSize * ChunkSize> Chunk;
+
+	// Spreads the packed chunk coordinates over all bits before they are
+	// reduced to a bucket index (splitmix64 finalizer).
+	struct ChunkKeyHash
+	{
+		size_t operator()(uint64_t key) const
+		{
+			key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9;
+			key = (key ^ (key >> 27)) * 0x94d049bb133111eb;
+
+			return static_cast<size_t>(key ^ (key >> 31));
+		}
+	};
+
+	static constexpr int chunkShift = std::countr_zero(ChunkSize);
+
+private:
+	// Arithmetic right shifts round towards negative infinity, so negative
+	// coordinates map to chunks just like positive ones.
+	static uint64_t chunkKey(int x, int y)
+	{
+		const uint32_t chunkX = static_cast<uint32_t>(x >> chunkShift);
+		const uint32_t chunkY = static_cast<uint32_t>(y >> chunkShift);
+
+		return (uint64_t(chunkY) << 32) | chunkX;
+	}
+
+	static size_t cellIndex(int x, int y)
+	{
+		return (static_cast<size_t>(y) & (ChunkSize - 1)) * ChunkSize + (static_cast<size_t>(x) & (ChunkSize - 1));
+	}
+
+	const Chunk* findChunk(uint64_t key) const
+	{
+		if(lastChunk_ && key == lastChunkKey_)
+			return lastChunk_;
+
+		// Const reads only consult the cache and never update it, so
+		// concurrent const access stays free of data races.
+		const auto found = chunks_.find(key);
+
+		return (found != chunks_.end()) ? found->second.get() : nullptr;
+	}
+
+	Chunk& chunk(uint64_t key)
+	{
+		if(lastChunk_ && key == lastChunkKey_)
+			return *lastChunk_;
+
+		auto& chunk = chunks_[key];
+
+		if(!chunk)
+		{
+			chunk = std::make_unique<Chunk>();
+			chunk->fill(initCell_);
+		}
+
+		lastChunkKey_ = key;
+		lastChunk_ = chunk.get();
+
+		return *lastChunk_;
+	}
+
+private:
+	T initCell_;
+	std::unordered_map<uint64_t, std::unique_ptr<Chunk>, ChunkKeyHash> chunks_;
+	uint64_t lastChunkKey_ = 0;
+	Chunk* lastChunk_ = nullptr;
+};
+
+enum class CompassDirection
+{
+	North = 0,
+	NorthEast,
+	East,
+	SouthEast,
+	South,
+	SouthWest,
+	West,
+	NorthWest,
+};
+
+constexpr Point2i compassDeltaPositionFor[] =
+{
+	{  0, -1 }, // CompassDirection::North
+	{  1, -1 }, // CompassDirection::NorthEast
+	{  1,  0 }, // CompassDirection::East
+	{  1,  1 }, // CompassDirection::SouthEast
+	{  0,  1 }, // CompassDirection::South
+	{ -1,  1 }, // CompassDirection::SouthWest
+	{ -1,  0 }, // CompassDirection::West
+	{ -1, -1 }, // CompassDirection::NorthWest
+};
+
+// Counts words read in straight lines through a character grid. Matching
+// works on the grid's cell buffer directly and does not allocate. Every
+// (start cell, direction) pair spelling the word counts once, so a
+// palindrome is counted in both directions of a line.
+class GridWordSearch
+{
+public:
+	typedef uint8_t DirectionMask;
+
+	static constexpr DirectionMask allDirections = 0xff;
+
+	static constexpr DirectionMask directionMask(CompassDirection direction)
+	{
+		return static_cast<DirectionMask>(1u << static_cast<unsigned>(direction));
+	}
+
+public:
+	static size_t countWord(const BoundedGrid2D<char>& grid,
+	                        std::string_view word,
+	                        DirectionMask directions=allDirections);
+};
+
+// A small rectangular pattern of characters matched against every window of
+// a character grid. Cells equal to the wildcard match anything. The pattern
+// can also match rotated and/or reflected; identical variants are merged, so
+// a symmetric pattern is not counted twice at the same window.
+class GridPattern
+{
+public:
+	typedef uint8_t Transformations;
+
+	static constexpr Transformations rotations = 1;
+	static constexpr Transformations reflections = 2;
+
+	struct Cell
+	{
+		size_t x_;
+		size_t y_;
+		char ch_;
+	};
+
+public:
+	GridPattern(const std::vector<std::string>& rows,
+	            char wildcard='.',
+	            Transformations transformations=0);
+
+public:
+	size_t numVariants() const { return variants_.size(); }
+
+	// Returns the number of (window, variant) pairs that match.
+	size_t count(const BoundedGrid2D<char>& grid) const;
+
+private:
+	struct Variant
+	{
+		size_t width_;
+		size_t height_;
+		std::vector<Cell> cells_;
+	};
+
+private:
+	std::vector<Variant> variants_;
+};
+
+// A grid of flags packed 64 to a word. Every row starts on a new word and the
+// bits past width() in its last word are always zero, so whole rows can be
+// combined and counted a word at a time.
+class BitGrid
+{
+public:
+	typedef uint64_t Word;
+
+	static constexpr size_t bitsPerWord = 64;
+	static constexpr size_t npos = std::string::npos;
+
+public:
+	BitGrid(size_t width=0, size_t height=0, bool initCell=false)
+	{
+		reset(width, height, initCell);
+	}
+
+	BitGrid(const BoundedGrid2D<char>& grid, char setChar)
+	{
+		reset(grid, setChar);
+	}
+
+public:
+	void reset(size_t width, size_t height, bool initCell=false);
+
+	// Sets exactly the cells of grid that equal setChar.
+	void reset(const BoundedGrid2D<char>& grid, char setChar);
+
+	void clear()
+	{
+		std::fill(words_.begin(), words_.end(), Word(0));
+	}
+
+public:
+	bool cell(size_t x, size_t y) const
+	{
+		AOC_ASSERT(x < width() && y < height());
+
+		return (words_[wordIndex(x, y)] >> (x % bitsPerWord)) & 1;
+	}
+
+	bool cell(const Point2uz& pos) const
+	{
+		return cell(pos.x_, pos.y_);
+	}
+
+	bool cell(const Point2i& pos) const
+	{
+		AOC_ASSERT(pos.x_ >= 0 && pos.y_ >= 0);
+
+		return cell(static_cast<size_t>(pos.x_), static_cast<size_t>(pos.y_));
+	}
+
+	void setCell(size_t x, size_t y, bool cell)
+	{
+		AOC_ASSERT(x < width() && y < height());
+
+		const Word mask = Word(1) << (x % bitsPerWord);
+
+		Word& word = words_[wordIndex(x, y)];
+
+		word = cell ? (word | mask) : (word & ~mask);
+	}
+
+	void setCell(const Point2uz& pos, bool cell)
+	{
+		setCell(pos.x_, pos.y_, cell);
+	}
+
+	void setCell(const Point2i& pos, bool cell)
+	{
+		AOC_ASSERT(pos.x_ >= 0 && pos.y_ >= 0);
+
+		setCell(static_cast<size_t>(pos.x_), static_cast<size_t>(pos.y_), cell);
+	}
+
+	// Sets the cell and returns whether it was already set.
+	bool testAndSetCell(size_t x, size_t y)
+	{
+		AOC_ASSERT(x < width() && y < height());
+
+		const Word mask = Word(1) << (x % bitsPerWord);
+
+		Word& word = words_[wordIndex(x, y)];
+
+		const bool wasSet = (word & mask) != 0;
+
+		word |= mask;
+
+		return wasSet;
+	}
+
+	bool testAndSetCell(const Point2uz& pos)
+	{
+		return testAndSetCell(pos.x_, pos.y_);
+	}
+
+	bool testAndSetCell(const Point2i& pos)
+	{
+		AOC_ASSERT(pos.x_ >= 0 && pos.y_ >= 0);
+
+		return testAndSetCell(static_cast<size_t>(pos.x_), static_cast<size_t>(pos.y_));
+	}
+
+	size_t width() const
+	{
+		return width_;
+	}
+
+	size_t height() const
+	{
+		return height_;
+	}
+
+	size_t numCells() const
+	{
+		return width() * height();
+	}
+
+	// Row y occupies the words data()[y * rowStride()] onwards; cell x of
+	// the row is bit x % bitsPerWord of word x / bitsPerWord.
+	Word* data() { return words_.data(); }
+	const Word* data() const { return words_.data(); }
+
+	size_t rowStride() const
+	{
+		return wordsPerRow_;
+	}
+
+	size_t count(bool cell=true) const;
+
+	Point2uz findCell(bool cell=true) const;
+
+	// Returns the first x >= fromX whose cell in row y is set, or npos.
+	size_t findFirstSetInRow(size_t y, size_t fromX=0) const;
+
+	std::string toString(char setChar='#', char unsetChar='.') const;
+
+public:
+	BitGrid& operator&=(const BitGrid& other);
+	BitGrid& operator|=(const BitGrid& other);
+	BitGrid& operator^=(const BitGrid& other);
+
+	friend BitGrid operator&(BitGrid lhs, const BitGrid& rhs) { return lhs &= rhs; }
+	friend BitGrid operator|(BitGrid lhs, const BitGrid& rhs) { return lhs |= rhs; }
+	friend BitGrid operator^(BitGrid lhs, const BitGrid& rhs) { return lhs ^= rhs; }
+
+	friend bool operator==(const BitGrid&,
+	                       const BitGrid&) = default;
+
+private:
+	size_t wordIndex(size_t x, size_t y) const
+	{
+		return y * wordsPerRow_ + x / bitsPerWord;
+	}
+
+	// The valid bits of the last word of every row.
+	Word lastWordMask() const
+	{
+		const size_t numBits = width_ % bitsPerWord;
+
+		return (numBits == 0) ? ~Word(0) : (Word(1) << numBits) - 1;
+	}
+
+private:
+	std::vector<Word, AlignedAllocator<Word, BoundedGrid2D<char>::alignment>> words_;
+	size_t width_ = 0;
+	size_t height_ = 0;
+	size_t wordsPerRow_ = 0;
+};
+
+// Iterative breadth-first and depth-first traversals over the cells of a
+// width x height grid. A traversal only steps between adjacent cells for
+// which canStep(from, to) returns true; canStep is asked about every step
+// out of a visited cell, including steps to cells that were visited before.
+// visit(pos) is called once per visited cell, in traversal order.
+//
+// The visited marks and the pending cell buffer are allocated once by
+// reset() and reused by every traversal: a new traversal bumps an epoch
+// instead of clearing the marks.
+class GridTraversal
+{
+public:
+	GridTraversal(size_t width=0, size_t height=0)
+	{
+		reset(width, height);
+	}
+
+public:
+	void reset(size_t width, size_t height);
+
+	size_t width() const { return width_; }
+	size_t height() const { return height_; }
+
+	// Whether pos was visited by the last traversal.
+	bool isVisited(const Point2uz& pos) const
+	{
+		AOC_ASSERT(pos.x_ < width_ && pos.y_ < height_);
+
+		return visitedIn_[index(pos)] == epoch_;
+	}
+
+public:
+	// Returns the number of visited cells.
+	template<class CanStep, class Visit>
+	size_t breadthFirst(const Point2uz& start, CanStep canStep, Visit visit)
+	{
+		return breadthFirst(std::span<const Point2uz>(&start, 1), canStep, visit);
+	}
+
+	// Starts from all the given cells at once.
+	template<class CanStep, class Visit>
+	size_t breadthFirst(std::span<const Point2uz> starts, CanStep canStep, Visit visit)
+	{
+		beginTraversal();
+
+		for(const Point2uz& start : starts)
+			push(start);
+
+		return traverse<true>(canStep, visit);
+	}
+
+	template<class CanStep, class Visit>
+	size_t depthFirst(const Point2uz& start, CanStep canStep, Visit visit)
+	{
+		beginTraversal();
+		push(start);
+
+		return traverse<false>(canStep, visit);
+	}
+
+	// Visits the region of cells around start for which isInside(pos) is true.
+	template<class IsInside, class Visit>
+	size_t floodFill(const Point2uz& start, IsInside isInside, Visit visit)
+	{
+		AOC_ASSERT(isInside(start));
+
+		return depthFirst(start, [&](const Point2uz&, const Point2uz& to) { return isInside(to); }, visit);
+	}
+
+	// Splits the grid into the components connected by canStep and calls
+	// visit(pos, component) for every cell. canStep is expected to be
+	// symmetric. Returns the number of components.
+	template<class CanStep, class Visit>
+	size_t connectedComponents(CanStep canStep, Visit visit)
+	{
+		beginTraversal();
+
+		size_t numComponents = 0;
+
+		for(size_t y=0; y<height_; ++y)
+		{
+			for(size_t x=0; x<width_; ++x)
+			{
+				if(visitedIn_[y * width_ + x] == epoch_)
+					continue;
+
+				const size_t component = numComponents++;
+
+				push(Point2uz(x, y));
+				traverse<false>(canStep, [&](const Point2uz& pos) { visit(pos, component); });
+			}
+		}
+
+		return numComponents;
+	}
+
+private:
+	typedef uint16_t Epoch;
+	typedef uint32_t CellIndex;
+
+private:
+	void beginTraversal();
+
+	CellIndex index(const Point2uz& pos) const
+	{
+		return static_cast<CellIndex>(pos.y_ * width_ + pos.x_);
+	}
+
+	void push(const Point2uz& pos)
+	{
+		AOC_ASSERT(pos.x_ < width_ && pos.y_ < height_);
+
+		const CellIndex cellIndex = index(pos);
+
+		if(visitedIn_[cellIndex] == epoch_)
+			return;
+
+		visitedIn_[cellIndex] = epoch_;
+		pending_[pendingEnd_++] = cellIndex;
+	}
+
+	// Every cell is pushed at most once per epoch, so pending_ never holds
+	// more than numCells entries. Breadth-first traversals consume it from
+	// the front, depth-first traversals from the back.
+	template<bool isBreadthFirst, class CanStep, class Visit>
+	size_t traverse(CanStep& canStep, Visit&& visit)
+	{
+		size_t numVisited = 0;
+
+		while(pendingBegin_ != pendingEnd_)
+		{
+			const CellIndex cellIndex = isBreadthFirst ? pending_[pendingBegin_++] : pending_[--pendingEnd_];
+			const Point2uz pos(cellIndex % width_, cellIndex / width_);
+
+			visit(pos);
+			++numVisited;
+
+			auto step = [&](size_t x, size_t y)
+			{
+				const Point2uz to(x, y);
+
+				if(canStep(pos, to))
+					push(to);
+			};
+
+			if(pos.y_ > 0          ) step(pos.x_  , pos.y_-1);
+			if(pos.x_ > 0          ) step(pos.x_-1, pos.y_  );
+			if(pos.x_ < width_ - 1 ) step(pos.x_+1, pos.y_  );
+			if(pos.y_ < height_ - 1) step(pos.x_  , pos.y_+1);
+		}
+
+		return numVisited;
+	}
+
+private:
+	size_t width_ = 0;
+	size_t height_ = 0;
+	std::vector<Epoch> visitedIn_;
+	Epoch epoch_ = 1;
+	std::vector<CellIndex> pending_;
+	size_t pendingBegin_ = 0;
+	size_t pendingEnd_ = 0;
+};
+
+// Priority queue for the monotone integer priorities of Dijkstra-like
+// searches: no priority is pushed below the last popped one or more than
+// maxPriorityIncrease above it, so a ring of buckets indexed by priority
+// can replace a binary heap.
+template<class T>
+class BucketQueue
+{
+public:
+	explicit BucketQueue(size_t maxPriorityIncrease=0, size_t minPriority=0)
+	{
+		reset(maxPriorityIncrease, minPriority);
+	}
+
+public:
+	// Keeps the capacity of the buckets for the next search. No priority
+	// may be pushed below minPriority.
+	void reset(size_t maxPriorityIncrease, size_t minPriority=0)
+	{
+		for(auto& bucket : buckets_)
+			bucket.clear();
+
+		buckets_.resize(maxPriorityIncrease + 1);
+		size_ = 0;
+		priority_ = minPriority;
+	}
+
+	bool empty() const { return size_ == 0; }
+	size_t size() const { return size_; }
+
+	// The priority of the last popped item.
+	size_t priority() const { return priority_; }
+
+	void push(size_t priority, const T& item)
+	{
+		AOC_ASSERT(priority >= priority_ && priority - priority_ < buckets_.size());
+
+		buckets_[priority % buckets_.size()].push_back(item);
+		++size_;
+	}
+
+	T pop()
+	{
+		AOC_ASSERT(!empty());
+
+		while(buckets_[priority_ % buckets_.size()].empty())
+			++priority_;
+
+		auto& bucket = buckets_[priority_ % buckets_.size()];
+
+		const T item = bucket.back();
+
+		bucket.pop_back();
+		--size_;
+
+		return item;
+	}
+
+private:
+	std::vector<std::vector<T>> buckets_;
+	size_t size_ = 0;
+	size_t priority_ = 0;
+};
+
+// Shortest paths over the cells of a width x height grid with small integer
+// step costs. stepCost(from, to) returns the cost of moving between two
+// adjacent cells, at most maxStepCost, or noStep where there is no step.
+//
+// With directed states a path state is a cell together with the direction
+// the path faces: moving forward costs stepCost, and turning left or right
+// in place costs turnCost.
+class GridPathFinder
+{
+public:
+	typedef uint32_t Cost;
+
+	static constexpr Cost noStep = std::numeric_limits<Cost>::max();
+	static constexpr Cost unreachable = std::numeric_limits<Cost>::max();
+
+	struct Start
+	{
+		Start(const Point2uz& position, Direction direction=Direction::East)
+			: position_(position)
+			, direction_(direction)
+		{
+		}
+
+		Point2uz position_;
+		Direction direction_;
+	};
+
+public:
+	GridPathFinder(size_t width=0, size_t height=0, Cost maxStepCost=1, bool isDirected=false, Cost turnCost=0)
+	{
+		reset(width, height, maxStepCost, isDirected, turnCost);
+	}
+
+public:
+	void reset(size_t width, size_t height, Cost maxStepCost=1, bool isDirected=false, Cost turnCost=0);
+
+	size_t width() const { return width_; }
+	size_t height() const { return height_; }
+	bool isDirected() const { return numDirections_ > 1; }
+
+	// Computes the distances from start to all cells.
+	template<class StepCost>
+	void dijkstra(const Start& start, StepCost stepCost)
+	{
+		search(start, nullptr, stepCost, 0);
+	}
+
+	// Returns the distance from start to goal, or unreachable. The search
+	// stops once goal is reached.
+	template<class StepCost>
+	Cost dijkstra(const Start& start, const Point2uz& goal, StepCost stepCost)
+	{
+		return search(start, &goal, stepCost, 0);
+	}
+
+	// Like dijkstra(), guided by the Manhattan distance to goal. No step may
+	// cost less than minStepCost.
+	template<class StepCost>
+	Cost aStar(const Start& start, const Point2uz& goal, StepCost stepCost, Cost minStepCost=1)
+	{
+		return search(start, &goal, stepCost, minStepCost);
+	}
+
+	// The distance of the last search to pos, facing any direction. Only
+	// the distances of a search without goal are final for all cells.
+	Cost distance(const Point2uz& pos) const
+	{
+		AOC_ASSERT(pos.x_ < width_ && pos.y_ < height_);
+
+		const size_t cellIndex = pos.y_ * width_ + pos.x_;
+
+		return *std::min_element(distances_.begin() + cellIndex * numDirections_,
+		                         distances_.begin() + (cellIndex + 1) * numDirections_);
+	}
+
+	Cost distance(const Point2uz& pos, Direction facing) const
+	{
+		AOC_ASSERT(isDirected() && pos.x_ < width_ && pos.y_ < height_);
+
+		return distances_[stateIndex(pos, facing)];
+	}
+
+private:
+	typedef uint32_t StateIndex;
+
+private:
+	StateIndex stateIndex(const Point2uz& pos, Direction facing) const
+	{
+		const size_t cellIndex = pos.y_ * width_ + pos.x_;
+
+		return static_cast<StateIndex>(isDirected() ? cellIndex * numDirections_ + static_cast<size_t>(facing) : cellIndex);
+	}
+
+	static size_t absDifference(size_t a, size_t b)
+	{
+		return (a > b) ? a - b : b - a;
+	}
+
+	// Items in the queue are only states; an item is stale when the distance
+	// of its state has dropped since it was pushed.
+	template<class StepCost>
+	Cost search(const Start& start, const Point2uz* goal, StepCost& stepCost, Cost heuristicWeight)
+	{
+		AOC_ASSERT(start.position_.x_ < width_ && start.position_.y_ < height_);
+
+		std::fill(distances_.begin(), distances_.end(), unreachable);
+
+		auto heuristic = [&](const Point2uz& pos) -> size_t
+		{
+			if(heuristicWeight == 0)
+				return 0;
+
+			return (absDifference(pos.x_, goal->x_) + absDifference(pos.y_, goal->y_)) * heuristicWeight;
+		};
+
+		// A forward step changes the heuristic by heuristicWeight, a turn
+		// does not change it.
+		queue_.reset(std::max(maxStepCost_ + heuristicWeight, turnCost_), heuristic(start.position_));
+
+		auto relax = [&](const Point2uz& pos, Direction facing, Cost cost)
+		{
+			const StateIndex state = stateIndex(pos, facing);
+
+			if(cost < distances_[state])
+			{
+				distances_[state] = cost;
+				queue_.push(cost + heuristic(pos), state);
+			}
+		};
+
+		relax(start.position_, start.direction_, 0);
+
+		while(!queue_.empty())
+		{
+			const StateIndex state = queue_.pop();
+			const size_t cellIndex = state / numDirections_;
+			const Point2uz pos(cellIndex % width_, cellIndex / width_);
+			const Cost cost = distances_[state];
+
+			if(cost + heuristic(pos) != queue_.priority())
+				continue;
+
+			if(goal && pos == *goal)
+				return cost;
+
+			auto step = [&](Direction direction)
+			{
+				const Point2i to = nextPosition(Point2i(pos), direction);
+
+				if(to.x_ < 0 || to.y_ < 0 || size_t(to.x_) >= width_ || size_t(to.y_) >= height_)
+					return;
+
+				const Cost toCost = stepCost(pos, Point2uz(to));
+
+				if(toCost == noStep)
+					return;
+
+				AOC_ASSERT(toCost <= maxStepCost_ && toCost >= heuristicWeight);
+
+				relax(Point2uz(to), direction, cost + toCost);
+			};
+
+			if(isDirected())
+			{
+				const Direction facing = static_cast<Direction>(state % numDirections_);
+
+				step(facing);
+				relax(pos, turnLeft(facing), cost + turnCost_);
+				relax(pos, turnRight(facing), cost + turnCost_);
+			}
+			else
+			{
+				step(Direction::North);
+				step(Direction::West);
+				step(Direction::East);
+				step(Direction::South);
+			}
+		}
+
+		return unreachable;
+	}
+
+private:
+	size_t width_ = 0;
+	size_t height_ = 0;
+	size_t numDirections_ = 1;
+	Cost maxStepCost_ = 1;
+	Cost turnCost_ = 0;
+	std::vector<Cost> distances_;
+	BucketQueue<StateIndex> queue_;
+};
+
+// Steps a cellular automaton over a grid of chars generation by generation.
+// The cells live in two padded buffers whose border holds outsideCell; a
+// generation writes the next state of every cell into the other buffer and
+// then swaps the buffers. The rows are split into bands that are updated on
+// separate threads, so rules have to be safe to call concurrently. An
+// exception thrown by a rule is rethrown once all bands are done.
+class CellularAutomaton
+{
+public:
+	static constexpr size_t defaultMinNumRowsPerBand = 256;
+
+	// The eight neighbors of a cell, border included.
+	class Neighborhood
+	{
+		friend class CellularAutomaton;
+
+	public:
+		char cell() const { return center_[0]; }
+
+		char cell(int dx, int dy) const
+		{
+			AOC_ASSERT(dx >= -1 && dx <= 1 && dy >= -1 && dy <= 1);
+
+			return center_[static_cast<ptrdiff_t>(dy) * static_cast<ptrdiff_t>(stride_) + dx];
+		}
+
+		// The number of neighbors, not counting the cell itself, equal to ch.
+		size_t count(char ch) const
+		{
+			const char* above = center_ - stride_;
+			const char* below = center_ + stride_;
+
+			return (above[-1] == ch) + (above[0] == ch) + (above[1] == ch) +
+			       (center_[-1] == ch) + (center_[1] == ch) +
+			       (below[-1] == ch) + (below[0] == ch) + (below[1] == ch);
+		}
+
+	private:
+		Neighborhood(const char* center, size_t stride)
+			: center_(center)
+			, stride_(stride)
+		{
+		}
+
+	private:
+		const char* center_;
+		size_t stride_;
+	};
+
+	// A rule in which a cell is either alive or dead and its next state only
+	// depends on that and on its number of alive neighbors: bit n of
+	// birthCounts_ (survivalCounts_) is set if a dead (alive) cell with n
+	// alive neighbors is alive in the next generation. Cells that are not
+	// aliveCell_ count as dead. Stepping by such a rule takes a SIMD path.
+	struct LifeLikeRule
+	{
+		char aliveCell_ = '#';
+		char deadCell_ = '.';
+		uint16_t birthCounts_ = 1 << 3;
+		uint16_t survivalCounts_ = (1 << 2) | (1 << 3);
+	};
+
+public:
+	explicit CellularAutomaton(const BoundedGrid2D<char>& grid, char outsideCell='.',
+	                           size_t numThreads=std::max(1u, std::thread::hardware_concurrency()),
+	                           size_t minNumRowsPerBand=defaultMinNumRowsPerBand)
+		: numThreads_(numThreads)
+		, minNumRowsPerBand_(minNumRowsPerBand)
+	{
+		AOC_ASSERT(numThreads >= 1);
+		AOC_ASSERT(minNumRowsPerBand >= 1);
+
+		reset(grid, outsideCell);
+	}
+
+public:
+	void reset(const BoundedGrid2D<char>& grid, char outsideCell='.');
+
+	size_t width() const { return cells_.width(); }
+	size_t height() const { return cells_.height(); }
+	size_t generation() const { return generation_; }
+
+	char cell(size_t x, size_t y) const { return cells_.cell(x, y); }
+	char cell(const Point2uz& pos) const { return cells_.cell(pos); }
+
+	void setCell(size_t x, size_t y, char cell) { cells_.setCell(x, y, cell); }
+	void setCell(const Point2uz& pos, char cell) { cells_.setCell(pos, cell); }
+
+	size_t count(char cell) const;
+
+	BoundedGrid2D<char> grid() const;
+
+	std::string toString() const
+	{
+		return cells_.toString();
+	}
+
+public:
+	// rule(const Neighborhood&) returns the next state of a cell.
+	template<class Rule>
+	void step(Rule rule, size_t numGenerations=1)
+	{
+		for(size_t i=0; i<numGenerations; ++i)
+		{
+			const size_t stride = cells_.rowStride();
+
+			forEachBand([&](size_t startY, size_t endY)
+			{
+				for(size_t y=startY; y<endY; ++y)
+				{
+					const char* row = cells_.data() + cells_.index(0, y);
+					char* nextRow = nextCells_.data() + nextCells_.index(0, y);
+
+					for(size_t x=0; x<width(); ++x)
+						nextRow[x] = rule(Neighborhood(row + x, stride));
+				}
+			});
+
+			swapBuffers();
+		}
+	}
+
+	void step(const LifeLikeRule& rule, size_t numGenerations=1);
+
+private:
+	template<class UpdateBand>
+	void forEachBand(UpdateBand updateBand)
+	{
+		const size_t numBands = std::max<size_t>(1, std::min(numThreads_, height() / minNumRowsPerBand_));
+
+		std::vector<std::exception_ptr> bandExceptions(numBands);
+
+		auto runBand = [&](size_t bandIndex)
+		{
+			try
+			{
+				updateBand(height() * bandIndex / numBands, height() * (bandIndex + 1) / numBands);
+			}
+			catch(...)
+			{
+				bandExceptions[bandIndex] = std::current_exception();
+			}
+		};
+
+		std::vector<std::thread> threads;
+
+		for(size_t i=1; i<numBands; ++i)
+			threads.emplace_back(runBand, i);
+
+		runBand(0);
+
+		for(auto& thread : threads)
+			thread.join();
+
+		for(const auto& bandException : bandExceptions)
+			if(bandException)
+				std::rethrow_exception(bandException);
+	}
+
+	void swapBuffers()
+	{
+		std::swap(cells_, nextCells_);
+		++generation_;
+	}
+
+private:
+	PaddedGrid2D<char> cells_;
+	PaddedGrid2D<char> nextCells_;
+	size_t generation_ = 0;
+	size_t numThreads_;
+	size_t minNumRowsPerBand_;
+};
+
+enum class InputMode
+{
+	Buffered,
+	Streaming,
+	StreamingWithReadAhead,
+};
+
+template<class T=int>
+class PuzzleSolution
+{
+public:
+	explicit PuzzleSolution(InputMode inputMode=InputMode::Buffered)
+		: inputMode_(inputMode)
+	{
+	}
+
+	virtual ~PuzzleSolution() {}
+
+public:
+	int run(const std::string& puzzleInputFilePath);
+
+protected:
+	const PuzzleInput& puzzleInput() const { return puzzleInput_; }
+	const std::vector<std::string>& input() const;
+
+protected:
+	virtual void processInput(const std::string& puzzleInputFilePath);
+
+	// Called for every input line, in order, by processInput when the
+	// solution runs in one of the streaming input modes. Nothing is retained, so
+	// input() and puzzleInput() stay empty in that mode.
+	virtual void processLine(std::string_view line);
+
+private:
+	virtual T answer1() = 0;
+	virtual T answer2() = 0;
+
+private:
+	InputMode inputMode_;
+	PuzzleInput puzzleInput_;
+	mutable std::vector<std::string> input_;
+	mutable bool isInputMaterialized_ = false;
+};
+
+template<class T>
+int PuzzleSolution<T>::run(const std::string& puzzleInputFilePath)
+{
+	processInput(puzzleInputFilePath);
+
+	fmt::println("{}", answer1());
+	fmt::println("{}", answer2());
+
+	return EXIT_SUCCESS;
+}
+
+template<class T>
+void PuzzleSolution<T>::processInput(const std::string& puzzleInputFilePath)
+{
+	input_.clear();
+	isInputMaterialized_ = false;
+
+	switch(inputMode_)
+	{
+		case InputMode::Buffered:
+		{
+			puzzleInput_.load(puzzleInputFilePath);
+
+			break;
+		}
+
+		case InputMode::Streaming:
+		{
+			puzzleInput_.clear();
+
+			LineSource lineSource(puzzleInputFilePath);
+			std::string_view line;
+
+			while(lineSource.nextLine(line))
+				processLine(line);
+
+			break;
+		}
+
+		case InputMode::StreamingWithReadAhead:
+		{
+			puzzleInput_.clear();
+
+			ReadAheadLineSource lineSource(puzzleInputFilePath);
+			std::string_view line;
+
+			while(lineSource.nextLine(line))
+				processLine(line);
+
+			break;
+		}
+	}
+}
+
+template<class T>
+void PuzzleSolution<T>::processLine(std::string_view /*line*/)
+{
+	panic("processLine must be overridden by solutions using a streaming input mode");
+}
+
+// Owning copies of the lines are only made for solutions that ask for them;
+// solutions parsing straight from puzzleInput() never pay for the copy.
+template<class T>
+const std::vector<std::string>& PuzzleSolution<T>::input() const
+{
+	if(!isInputMaterialized_)
+	{
+		input_ = puzzleInput_.toLines();
+		isInputMaterialized_ = true;
+	}
+
+	return input_;
+}
+
+class MathUtils
+{
+public:
+	template<class T>
+	static bool isInRange(const T& value, const T& rangeStart, const T& rangeEnd)
+	{
+		return (value >= rangeStart) && (value <= rangeEnd);
+	}
+
+	static int manhattanDistance(int x1, int y1, int x2, int y2)
+	{
+		return abs(x2 - x1) + abs(y2 - y1);
+	}
+};
+
+// Non-allocating integer scanners working on a string_view and a cursor
+// position. Runs of eight digits are converted at once (SWAR); numbers too
+// long for that to be overflow-free are handed over to std::from_chars.
+class ParseUtils
+{
+public:
+	static constexpr bool isDigit(char ch)
+	{
+		return (ch >= '0') && (ch <= '9');
+	}
+
+	static constexpr bool isWhitespace(char ch)
+	{
+		return (ch == ' ') || (ch == '\t') || (ch == '\n') || (ch == '\r') || (ch == '\v') || (ch == '\f');
+	}
+
+	static void skipWhitespace(std::string_view str, size_t& pos);
+	static void skipDelimiters(std::string_view str, size_t& pos, std::string_view delimiters);
+	static bool skipChar(std::string_view str, size_t& pos, char ch);
+
+	// Parses the integer starting exactly at pos and moves pos past it.
+	// Returns false (leaving pos untouched) if there is no integer at pos.
+	template<class Integer>
+	static bool parseInteger(std::string_view str, size_t& pos, Integer& value);
+
+	// Like parseInteger but first skips everything that cannot start an
+	// integer. Returns false (with pos at the end) if no integer is left.
+	template<class Integer>
+	static bool parseNextInteger(std::string_view str, size_t& pos, Integer& value);
+
+	// Appends all integers found in str to values.
+	template<class Integer>
+	static void parseIntegers(std::string_view str, std::vector<Integer>& values);
+
+	// Converts str, which may be surrounded by whitespace, to an integer.
+	template<class Integer>
+	static Integer toInteger(std::string_view str);
+
+private:
+	static uint64_t loadEightBytes(const char* data)
+	{
+		uint64_t chunk;
+		std::memcpy(&chunk, data, sizeof(chunk));
+		return chunk;
+	}
+
+	static bool areEightDigits(uint64_t chunk)
+	{
+		return (((chunk + 0x4646464646464646) | (chunk - 0x3030303030303030)) & 0x8080808080808080) == 0;
+	}
+
+	static uint32_t parseEightDigits(uint64_t chunk)
+	{
+		chunk -= 0x3030303030303030;
+		chunk = (chunk * 10) + (chunk >> 8);
+		chunk = (((chunk & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) +
+		         (((chunk >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >> 32;
+
+		return static_cast<uint32_t>(chunk);
+	}
+};
+
+template<class Integer>
+bool ParseUtils::parseInteger(std::string_view str, size_t& pos, Integer& value)
+{
+	static_assert(std::is_integral_v<Integer> && (sizeof(Integer) <= sizeof(uint64_t)));
+
+	size_t digitsPos = pos;
+	bool isNegative = false;
+
+	if constexpr(std::is_signed_v<Integer>)
+	{
+		if((digitsPos < str.size()) && (str[digitsPos] == '-'))
+		{
+			isNegative = true;
+			++digitsPos;
+		}
+	}
+
+	const char* data = str.data();
+	size_t endPos = digitsPos;
+	uint64_t magnitude = 0;
+
+	// The SWAR conversion relies on the first character ending up in the
+	// lowest byte of the loaded chunk.
+	if constexpr(std::endian::native == std::endian::little)
+	{
+		while(endPos + 8 <= str.size())
+		{
+			const uint64_t chunk = loadEightBytes(data + endPos);
+
+			if(!areEightDigits(chunk))
+				break;
+
+			magnitude = magnitude * 100000000 + parseEightDigits(chunk);
+			endPos += 8;
+		}
+	}
+
+	while((endPos < str.size()) && isDigit(str[endPos]))
+	{
+		magnitude = magnitude * 10 + (str[endPos] - '0');
+		++endPos;
+	}
+
+	const size_t numDigits = endPos - digitsPos;
+
+	if(numDigits == 0)
+		return false;
+
+	if(numDigits <= std::numeric_limits<Integer>::digits10)
+	{
+		value = static_cast<Integer>(magnitude);
+
+		if constexpr(std::is_signed_v<Integer>)
+			if(isNegative)
+				value = -value;
+	}
+	else
+	{
+		const auto [end, error] = std::from_chars(data + pos, data + endPos, value);
+
+		AOC_ENFORCE_MSG(error == std::errc(), "integer out of range");
+		AOC_ASSERT(end == data + endPos);
+	}
+
+	pos = endPos;
+
+	return true;
+}
+
+template<class Integer>
+bool ParseUtils::parseNextInteger(std::string_view str, size_t& pos, Integer& value)
+{
+	while(pos < str.size())
+	{
+		if(isDigit(str[pos]))
+			break;
+
+		if constexpr(std::is_signed_v<Integer>)
+			if((str[pos] == '-') && (pos + 1 < str.size()) && isDigit(str[pos + 1]))
+				break;
+
+		++pos;
+	}
+
+	return parseInteger(str, pos, value);
+}
+
+template<class Integer>
+void ParseUtils::parseIntegers(std::string_view str, std::vector<Integer>& values)
+{
+	size_t pos = 0;
+	Integer value = 0;
+
+	while(parseNextInteger(str, pos, value))
+		values.push_back(value);
+}
+
+template<class Integer>
+Integer ParseUtils::toInteger(std::string_view str)
+{
+	size_t pos = 0;
+	Integer value = 0;
+
+	skipWhitespace(str, pos);
+
+	AOC_ENFORCE_MSG(parseInteger(str, pos, value), "integer expected");
+
+	skipWhitespace(str, pos);
+
+	AOC_ENFORCE_MSG(pos == str.size(), "unexpected characters after integer");
+
+	return value;
+}
+
+// A pattern string usable as a template argument, e.g. Pattern<"{a}{d}">.
+template<size_t N>
+struct PatternString
+{
+	constexpr PatternString(const char (&str)[N])
+	{
+		std::copy_n(str, N, chars_);
+	}
+
+	constexpr std::string_view view() const { return std::string_view(chars_, N - 1); }
+
+	char chars_[N];
+};
+
+struct PatternElement
+{
+	enum class Type { Literal, Digits, Letters };
+
+	constexpr bool matches(char ch) const
+	{
+		if(type_ == Type::Digits && ParseUtils::isDigit(ch))
+			return true;
+
+		if(type_ == Type::Letters && (((ch >= 'a') && (ch <= 'z')) || ((ch >= 'A') && (ch <= 'Z'))))
+			return true;
+
+		return extraChars_.find(ch) != std::string_view::npos;
+	}
+
+	Type type_ = Type::Literal;
+	char literal_ = 0;
+	std::string_view extraChars_;
+	size_t fieldIndex_ = 0;
+};
+
+// Splits a pattern into elements and returns the number of elements and
+// fields. panic() is not constexpr, so a malformed pattern does not compile.
+constexpr std::pair<size_t, size_t> compilePattern(std::string_view pattern, PatternElement* elements=nullptr)
+{
+	size_t numElements = 0;
+	size_t numFields = 0;
+
+	for(size_t i=0; i<pattern.size(); ++i)
+	{
+		PatternElement element;
+
+		if((pattern[i] == '{') && (i + 1 < pattern.size()) && (pattern[i + 1] == '{'))
+		{
+			element.literal_ = '{';
+			++i;
+		}
+		else if(pattern[i] == '{')
+		{
+			const size_t end = pattern.find('}', i);
+
+			if((end == std::string_view::npos) || (end < i + 2))
+				panic("unterminated or empty pattern field");
+
+			switch(pattern[i + 1])
+			{
+				case 'd': element.type_ = PatternElement::Type::Digits; break;
+				case 'a': element.type_ = PatternElement::Type::Letters; break;
+
+				default: panic("unknown pattern field type");
+			}
+
+			element.extraChars_ = pattern.substr(i + 2, end - i - 2);
+			element.fieldIndex_ = numFields++;
+
+			i = end;
+		}
+		else
+			element.literal_ = pattern[i];
+
+		if(elements)
+			elements[numElements] = element;
+
+		++numElements;
+	}
+
+	return std::make_pair(numElements, numFields);
+}
+
+// Compile-time checked matcher for simple fixed line formats, a typed
+// scanf of sorts. The pattern consists of literal characters and fields:
+//
+//   {d}     a run of digits
+//   {a}     a run of letters
+//   {d.-}   a run of digits, '.' or '-' (any extra characters may follow)
+//   {{      a literal '{'
+//
+// match() succeeds only if the whole string matches, and then stores each
+// field in the corresponding argument: a std::string_view or std::string
+// receives the text, a char the only character of the run and an integer
+// its value. Runs are greedy but give characters back when the rest of
+// the pattern would not match otherwise. Nothing is allocated unless a
+// std::string argument is passed.
+template<PatternString pattern>
+class Pattern
+{
+public:
+	static constexpr size_t numElements = compilePattern(pattern.view()).first;
+	static constexpr size_t numFields = compilePattern(pattern.view()).second;
+
+	template<class... Fields>
+	static bool match(std::string_view str, Fields&... fields);
+
+private:
+	static constexpr std::array<PatternElement, numElements> compileElements()
+	{
+		std::array<PatternElement, numElements> elements;
+
+		compilePattern(pattern.view(), elements.data());
+
+		return elements;
+	}
+
+	static constexpr std::array<PatternElement, numElements> elements_ = compileElements();
+
+	template<size_t elementIndex>
+	static bool matchFrom(std::string_view str, size_t pos, std::array<std::string_view, numFields>& fieldTexts);
+
+	template<class Field>
+	static bool convert(std::string_view text, Field& field);
+};
+
+template<PatternString pattern>
+template<class... Fields>
+bool Pattern<pattern>::match(std::string_view str, Fields&... fields)
+{
+	static_assert(sizeof...(Fields) == numFields, "the number of arguments has to match the number of pattern fields");
+
+	std::array<std::string_view, numFields> fieldTexts;
+
+	if(!matchFrom<0>(str, 0, fieldTexts))
+		return false;
+
+	size_t fieldIndex = 0;
+
+	return (convert(fieldTexts[fieldIndex++], fields) && ...);
+}
+
+template<PatternString pattern>
+template<size_t elementIndex>
+bool Pattern<pattern>::matchFrom(std::string_view str, size_t pos, std::array<std::string_view, numFields>& fieldTexts)
+{
+	if constexpr(elementIndex == numElements)
+		return pos == str.size();
+	else
+	{
+		constexpr PatternElement element = elements_[elementIndex];
+
+		if constexpr(element.type_ == PatternElement::Type::Literal)
+			return (pos < str.size()) && (str[pos] == element.literal_) && matchFrom<elementIndex + 1>(str, pos + 1, fieldTexts);
+		else
+		{
+			size_t end = pos;
+
+			while((end < str.size()) && element.matches(str[end]))
+				++end;
+
+			for(; end>pos; --end)
+			{
+				if(matchFrom<elementIndex + 1>(str, end, fieldTexts))
+				{
+					fieldTexts[element.fieldIndex_] = str.substr(pos, end - pos);
+					return true;
+				}
+
+				// A run ending the pattern has to extend to the end of str.
+				if constexpr(elementIndex + 1 == numElements)
+					return false;
+			}
+
+			return false;
+		}
+	}
+}
+
+template<PatternString pattern>
+template<class Field>
+bool Pattern<pattern>::convert(std::string_view text, Field& field)
+{
+	if constexpr(std::is_same_v<Field, std::string_view> || std::is_same_v<Field, std::string>)
+	{
+		field = text;
+		return true;
+	}
+	else if constexpr(std::is_same_v<Field, char>)
+	{
+		if(text.size() != 1)
+			return false;
+
+		field = text[0];
+		return true;
+	}
+	else
+	{
+		static_assert(std::is_integral_v<Field>, "pattern fields can only be stored in strings, chars and integers");
+
+		size_t pos = 0;
+
+		return ParseUtils::parseInteger(text, pos, field) && (pos == text.size());
+	}
+}
+
+// Lazily splits a string into string_view tokens, following the same rules
+// as StringUtils::tokenize, without allocating. The tokens point into the
+// tokenized string, which has to outlive them.
+class Tokenizer
+{
+public:
+	class Iterator
+	{
+		friend class Tokenizer;
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = std::string_view;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const std::string_view*;
+		using reference = const std::string_view&;
+
+		Iterator() = default;
+
+		reference operator*() const { return token_; }
+		pointer operator->() const { return &token_; }
+
+		Iterator& operator++() { advance(); return *this; }
+		Iterator operator++(int) { Iterator it = *this; advance(); return it; }
+
+		bool operator==(const Iterator& other) const { return tokenPos_ == other.tokenPos_; }
+
+	private:
+		explicit Iterator(const Tokenizer* tokenizer);
+
+		void advance();
+
+	private:
+		const Tokenizer* tokenizer_ = nullptr;
+		size_t tokenPos_ = std::string_view::npos;
+		size_t nextTokenPos_ = 0;
+		std::string_view token_;
+	};
+
+public:
+	explicit Tokenizer(std::string_view str,
+	                   char delimiter=',',
+	                   bool trimWhitespace=true,
+	                   bool skipEmptyTokens=false)
+		: str_(str)
+		, delimiter_(delimiter)
+		, trimWhitespace_(trimWhitespace)
+		, skipEmptyTokens_(skipEmptyTokens)
+	{
+	}
+
+	Iterator begin() const { return Iterator(this); }
+	Iterator end() const { return Iterator(); }
+
+private:
+	std::string_view str_;
+	char delimiter_;
+	bool trimWhitespace_;
+	bool skipEmptyTokens_;
+};
+
+// Replaces every occurrence of a set of literal patterns in a single pass
+// over the input, using an Aho-Corasick automaton. When matches overlap
+// the one ending first wins, and of the matches ending at the same
+// position the longest one does.
+class LiteralReplacer
+{
+public:
+	explicit LiteralReplacer(const std::vector<std::pair<std::string, std::string>>& replacements);
+
+	// Writes the result into result, which is cleared first, so that a
+	// buffer reused across calls stops allocating once it is large enough.
+	void replaceAll(std::string_view str, std::string& result) const;
+	std::string replaceAll(std::string_view str) const;
+
+	size_t numPatterns() const { return replacements_.size(); }
+
+private:
+	static constexpr size_t alphabetSize = 256;
+
+	struct Match
+	{
+		uint32_t patternLength_ = 0;
+		uint32_t replacementIndex_ = 0;
+	};
+
+	uint32_t addState();
+
+private:
+	std::vector<std::string> replacements_;
+	std::vector<uint32_t> transitions_;
+	std::vector<Match> matches_;
+};
+
+// Lazily enumerates the k-length variations with repetition of a set of
+// elements, in the order StringUtils::generateVariations produces them,
+// using O(k) memory. Every variation has an ordinal, so the space can be
+// split into ranges (e.g. one per thread) with iteratorAt.
+class Variations
+{
+public:
+	class Iterator
+	{
+		friend class Variations;
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = std::string_view;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = std::string_view;
+
+		Iterator() = default;
+
+		std::string_view operator*() const { return variation_; }
+		size_t ordinal() const { return ordinal_; }
+
+		Iterator& operator++();
+		Iterator operator++(int) { Iterator it = *this; ++*this; return it; }
+
+		bool operator==(const Iterator& other) const { return ordinal_ == other.ordinal_; }
+
+	private:
+		Iterator(const Variations* variations, size_t ordinal);
+
+	private:
+		const Variations* variations_ = nullptr;
+		size_t ordinal_ = 0;
+		std::string variation_;
+	};
+
+public:
+	Variations(const std::set<char>& elements, size_t k);
+
+	size_t size() const { return size_; }
+	size_t k() const { return k_; }
+
+	// Writes the variation with the given ordinal into variation, which
+	// has to hold k characters.
+	void variation(size_t ordinal, std::span<char> variation) const;
+	std::string operator[](size_t ordinal) const;
+
+	Iterator iteratorAt(size_t ordinal) const { return Iterator(this, ordinal); }
+	Iterator begin() const { return iteratorAt(0); }
+	Iterator end() const { return iteratorAt(size_); }
+
+private:
+	std::string elements_;
+	char nextElements_[256] = {};
+	size_t k_;
+	size_t size_;
+};
+
+class StringUtils
+{
+public:
+	static bool contains(const std::string& str,
+	                     const std::string& substr);
+	static bool contains(const std::string& str, char ch);
+
+	static size_t countOverlappingSubstrings(std::string_view str,
+	                                         std::string_view substr);
+	static size_t countNonOverlappingSubstrings(std::string_view str,
+	                                            std::string_view substr);
+
+	// Counts the occurrences of several substrings (e.g. a word and its
+	// reverse) in a single pass over str, adding them to counts. Each
+	// substring is counted on its own, non-overlapping with itself unless
+	// countOverlapping is set.
+	static void countSubstrings(std::string_view str,
+	                            std::span<const std::string_view> substrs,
+	                            std::span<size_t> counts,
+	                            bool countOverlapping=false);
+
+	static std::string replaceFirst(const std::string& str,
+	                                const std::string& substr,
+	                                const std::string& substr2);
+	static std::string replaceLast(const std::string& str,
+	                               const std::string& substr,
+	                               const std::string& substr2);
+	static std::string replaceAll(const std::string& str,
+	                              const std::string& substr,
+	                              const std::string& substr2);
+	static void replaceAll(std::string_view str,
+	                       std::string_view substr,
+	                       std::string_view substr2,
+	                       std::string& result);
+
+	static std::vector<std::string> tokenize(const std::string& str,
+	                                         char delimiter=',',
+	                                         bool trimWhitespace=true,
+	                                         bool skipEmptyTokens=false);
+
+	// Writes the first tokens.size() tokens of str into tokens and returns
+	// the total number of tokens found.
+	static size_t tokenize(std::string_view str,
+	                       std::span<std::string_view> tokens,
+	                       char delimiter=',',
+	                       bool trimWhitespace=true,
+	                       bool skipEmptyTokens=false);
+
+	static std::string trim(const std::string& str);
+	static std::string ltrim(const std::string& str);
+	static std::string rtrim(const std::string& str);
+
+	static std::string_view trimView(std::string_view str);
+	static std::string_view ltrimView(std::string_view str);
+	static std::string_view rtrimView(std::string_view str);
+
+	static std::string trim(std::string str, char ch);
+	static std::string ltrim(std::string str, char ch);
+	static std::string rtrim(std::string str, char ch);
+
 	static void generateVariations(const std::set<char>& elements,
 	                               size_t k,
-	                               size_t i,
-	                               std::string sequence,
 	                               std::vector<std::string>& variations);
 };
 